@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -665,6 +666,78 @@ Image::Format Image::get_format() const {
 	return format;
 }
 
+// Images smaller than this are processed on the calling thread, as the cost
+// of dispatching work to the WorkerThreadPool outweighs the gain.
+#define IMAGE_THREADED_MIN_PIXELS (256 * 256)
+
+struct ImageRowsTask {
+	void (*func)(const ImageRowsTask &p_task, uint32_t p_from, uint32_t p_to) = nullptr;
+	void *userdata = nullptr;
+	uint32_t rows = 0;
+	uint32_t rows_per_chunk = 0;
+};
+
+static void _image_rows_chunk(void *p_task, uint32_t p_chunk) {
+	const ImageRowsTask *task = static_cast<const ImageRowsTask *>(p_task);
+	uint32_t from = p_chunk * task->rows_per_chunk;
+	uint32_t to = MIN(from + task->rows_per_chunk, task->rows);
+	task->func(*task, from, to);
+}
+
+// Runs `p_func` over the row range [0, p_rows), split in chunks across the
+// WorkerThreadPool when the amount of pixels to process is large enough.
+static void _image_process_rows(void (*p_func)(const ImageRowsTask &, uint32_t, uint32_t), void *p_userdata, uint32_t p_rows, uint64_t p_pixels) {
+	ImageRowsTask task;
+	task.func = p_func;
+	task.userdata = p_userdata;
+	task.rows = p_rows;
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Waiting for a group task from inside a pool thread may starve the pool, so only split work from other threads.
+	if (p_pixels < IMAGE_THREADED_MIN_PIXELS || p_rows < 2 || !pool || pool->get_thread_count() < 2 || WorkerThreadPool::get_thread_index() != -1) {
+		p_func(task, 0, p_rows);
+		return;
+	}
+
+	// A few chunks per thread keep the load balanced when rows have uneven cost.
+	uint32_t chunks = MIN(p_rows, (uint32_t)pool->get_thread_count() * 4);
+	task.rows_per_chunk = (p_rows + chunks - 1) / chunks;
+	chunks = (p_rows + task.rows_per_chunk - 1) / task.rows_per_chunk;
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&_image_rows_chunk, &task, chunks, -1, true, SNAME("ImageProcessRows"));
+	pool->wait_for_group_task_completion(group_task);
+}
+
+struct ImageScaleData {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	uint32_t src_width = 0;
+	uint32_t src_height = 0;
+	uint32_t dst_width = 0;
+	uint32_t dst_height = 0;
+};
+
+typedef void (*ImageScaleRowsFunc)(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to);
+
+template <ImageScaleRowsFunc scale_func>
+static void _scale_rows(const ImageRowsTask &p_task, uint32_t p_from, uint32_t p_to) {
+	const ImageScaleData *sd = static_cast<const ImageScaleData *>(p_task.userdata);
+	scale_func(sd->src, sd->dst, sd->src_width, sd->src_height, sd->dst_width, sd->dst_height, p_from, p_to);
+}
+
+// Scales the image, with destination rows processed in parallel.
+template <ImageScaleRowsFunc scale_func>
+static void _scale_threaded(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	ImageScaleData sd;
+	sd.src = p_src;
+	sd.dst = p_dst;
+	sd.src_width = p_src_width;
+	sd.src_height = p_src_height;
+	sd.dst_width = p_dst_width;
+	sd.dst_height = p_dst_height;
+	_image_process_rows(&_scale_rows<scale_func>, &sd, p_dst_height, (uint64_t)p_dst_width * p_dst_height);
+}
+
 static double _bicubic_interp_kernel(double x) {
 	x = ABS(x);
 
@@ -680,7 +753,7 @@ static double _bicubic_interp_kernel(double x) {
 }
 
 template <int CC, typename T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -695,7 +768,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_dst_y_from; y < p_dst_y_to; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -767,7 +840,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, typename T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -775,7 +848,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_dst_y_from; i < p_dst_y_to; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -857,8 +930,8 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, typename T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
+	for (uint32_t i = p_dst_y_from; i < p_dst_y_to; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -883,119 +956,171 @@ static float _lanczos(float p_x) {
 	return Math::abs(p_x) >= LANCZOS_TYPE ? 0 : Math::sincn(p_x) * Math::sincn(p_x / LANCZOS_TYPE);
 }
 
+struct ImageLanczosData {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	float *buffer = nullptr;
+	int32_t src_width = 0;
+	int32_t src_height = 0;
+	int32_t dst_width = 0;
+	int32_t dst_height = 0;
+
+	// Horizontal kernels are the same for every row, so they are computed once for each column.
+	int32_t h_kernel_size = 0;
+	const float *h_kernels = nullptr;
+	const int32_t *h_start = nullptr;
+	const int32_t *h_end = nullptr;
+};
+
 template <int CC, typename T>
-static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	int32_t src_width = p_src_width;
-	int32_t src_height = p_src_height;
-	int32_t dst_height = p_dst_height;
-	int32_t dst_width = p_dst_width;
+static void _scale_lanczos_horizontal(const ImageRowsTask &p_task, uint32_t p_from, uint32_t p_to) {
+	const ImageLanczosData *ld = static_cast<const ImageLanczosData *>(p_task.userdata);
 
-	uint32_t buffer_size = src_height * dst_width * CC;
-	float *buffer = memnew_arr(float, buffer_size); // Store the first pass in a buffer
+	for (uint32_t buffer_y = p_from; buffer_y < p_to; buffer_y++) {
+		const T *__restrict src_row = ((const T *)ld->src) + buffer_y * ld->src_width * CC;
+		float *__restrict dst_row = ld->buffer + buffer_y * ld->dst_width * CC;
 
-	{ // FIRST PASS (horizontal)
+		for (int32_t buffer_x = 0; buffer_x < ld->dst_width; buffer_x++) {
+			const float *kernel = ld->h_kernels + buffer_x * ld->h_kernel_size;
+			int32_t start_x = ld->h_start[buffer_x];
+			int32_t end_x = ld->h_end[buffer_x];
 
-		float x_scale = float(src_width) / float(dst_width);
+			float pixel[CC] = { 0 };
+			float weight = 0;
 
-		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
-		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+				float lanczos_val = kernel[target_x - start_x];
+				weight += lanczos_val;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+				const T *__restrict src_data = src_row + target_x * CC;
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
-			// The corresponding point on the source image
-			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+				for (uint32_t i = 0; i < CC; i++) {
+					if constexpr (sizeof(T) == 2) { //half float
+						pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+					} else {
+						pixel[i] += src_data[i] * lanczos_val;
+					}
+				}
+			}
 
-			// Create the kernel used by all the pixels of the column
-			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+			float *dst_data = dst_row + buffer_x * CC;
+
+			for (uint32_t i = 0; i < CC; i++) {
+				dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
 			}
+		}
+	}
+}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+template <int CC, typename T>
+static void _scale_lanczos_vertical(const ImageRowsTask &p_task, uint32_t p_from, uint32_t p_to) {
+	const ImageLanczosData *ld = static_cast<const ImageLanczosData *>(p_task.userdata);
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+	float y_scale = float(ld->src_height) / float(ld->dst_height);
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+	float scale_factor = MAX(y_scale, 1);
+	int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
-						}
-					}
-				}
+	float *kernel = memnew_arr(float, half_kernel * 2);
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+	for (int32_t dst_y = p_from; dst_y < (int32_t)p_to; dst_y++) {
+		float buffer_y = (dst_y + 0.5f) * y_scale;
+		int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+		int32_t end_y = MIN(ld->src_height - 1, int32_t(buffer_y) + half_kernel);
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
-				}
-			}
+		for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+			kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
 		}
 
-		memdelete_arr(kernel);
-	} // End of first pass
+		for (int32_t dst_x = 0; dst_x < ld->dst_width; dst_x++) {
+			float pixel[CC] = { 0 };
+			float weight = 0;
 
-	{ // SECOND PASS (vertical + result)
+			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+				float lanczos_val = kernel[target_y - start_y];
+				weight += lanczos_val;
 
-		float y_scale = float(src_height) / float(dst_height);
+				const float *buffer_data = ld->buffer + (target_y * ld->dst_width + dst_x) * CC;
 
-		float scale_factor = MAX(y_scale, 1);
-		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+				for (uint32_t i = 0; i < CC; i++) {
+					pixel[i] += buffer_data[i] * lanczos_val;
+				}
+			}
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+			T *dst_data = ((T *)ld->dst) + (dst_y * ld->dst_width + dst_x) * CC;
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (uint32_t i = 0; i < CC; i++) {
+				pixel[i] /= weight;
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				if constexpr (sizeof(T) == 1) { //byte
+					dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+				} else if constexpr (sizeof(T) == 2) { //half float
+					dst_data[i] = Math::make_half_float(pixel[i]);
+				} else { // float
+					dst_data[i] = pixel[i];
+				}
 			}
+		}
+	}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+	memdelete_arr(kernel);
+}
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+template <int CC, typename T>
+static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	ImageLanczosData ld;
+	ld.src = p_src;
+	ld.dst = p_dst;
+	ld.src_width = p_src_width;
+	ld.src_height = p_src_height;
+	ld.dst_width = p_dst_width;
+	ld.dst_height = p_dst_height;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+	uint32_t buffer_size = ld.src_height * ld.dst_width * CC;
+	ld.buffer = memnew_arr(float, buffer_size); // Store the first pass in a buffer
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
-					}
-				}
+	{ // FIRST PASS (horizontal)
 
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
+		float x_scale = float(ld.src_width) / float(ld.dst_width);
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
-
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
-					}
-				}
+		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
+		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+
+		ld.h_kernel_size = half_kernel * 2;
+		float *kernels = memnew_arr(float, ld.h_kernel_size * ld.dst_width);
+		int32_t *starts = memnew_arr(int32_t, ld.dst_width);
+		int32_t *ends = memnew_arr(int32_t, ld.dst_width);
+
+		for (int32_t buffer_x = 0; buffer_x < ld.dst_width; buffer_x++) {
+			// The corresponding point on the source image
+			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
+			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
+			int32_t end_x = MIN(ld.src_width - 1, int32_t(src_x) + half_kernel);
+			starts[buffer_x] = start_x;
+			ends[buffer_x] = end_x;
+
+			// Create the kernel used by all the pixels of the column
+			float *kernel = kernels + buffer_x * ld.h_kernel_size;
+			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
 			}
 		}
 
-		memdelete_arr(kernel);
-	} // End of second pass
+		ld.h_kernels = kernels;
+		ld.h_start = starts;
+		ld.h_end = ends;
+
+		_image_process_rows(&_scale_lanczos_horizontal<CC, T>, &ld, ld.src_height, (uint64_t)ld.src_height * ld.dst_width);
+
+		memdelete_arr(kernels);
+		memdelete_arr(starts);
+		memdelete_arr(ends);
+	} // End of first pass
+
+	// SECOND PASS (vertical + result)
+	_image_process_rows(&_scale_lanczos_vertical<CC, T>, &ld, ld.dst_height, (uint64_t)ld.dst_height * ld.dst_width);
 
-	memdelete_arr(buffer);
+	memdelete_arr(ld.buffer);
 }
 
 static void _overlay(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, float p_alpha, uint32_t p_width, uint32_t p_height, uint32_t p_pixel_size) {
@@ -1084,47 +1209,47 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_nearest<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<1, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_nearest<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<2, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_nearest<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<3, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<4, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_nearest<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<1, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<2, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_nearest<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<3, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_nearest<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<4, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_nearest<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<1, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<2, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_nearest<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<3, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_nearest<4, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1171,46 +1296,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 				if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 					switch (get_format_pixel_size(format)) {
 						case 1:
-							_scale_bilinear<1, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<1, uint8_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 2:
-							_scale_bilinear<2, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<2, uint8_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 3:
-							_scale_bilinear<3, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<3, uint8_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<4, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<4, uint8_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 					switch (get_format_pixel_size(format)) {
 						case 4:
-							_scale_bilinear<1, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<1, float>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<2, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<2, float>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 12:
-							_scale_bilinear<3, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<3, float>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 16:
-							_scale_bilinear<4, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<4, float>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 					switch (get_format_pixel_size(format)) {
 						case 2:
-							_scale_bilinear<1, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<1, uint16_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<2, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<2, uint16_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 6:
-							_scale_bilinear<3, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<3, uint16_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<4, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_threaded<_scale_bilinear<4, uint16_t>>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				}
@@ -1227,46 +1352,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_cubic<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<1, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_cubic<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<2, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_cubic<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<3, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<4, uint8_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_cubic<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<1, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<2, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_cubic<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<3, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_cubic<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<4, float>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_cubic<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<1, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<2, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_cubic<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<3, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_threaded<_scale_cubic<4, uint16_t>>(r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1668,15 +1793,14 @@ bool Image::_can_modify(Format p_format) const {
 template <typename Component, int CC, bool renormalize,
 		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
 		void (*renormalize_func)(Component *)>
-static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
 	//fast power of 2 mipmap generation
 	uint32_t dst_w = MAX(p_width >> 1, 1u);
-	uint32_t dst_h = MAX(p_height >> 1, 1u);
 
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
+	for (uint32_t i = p_dst_y_from; i < p_dst_y_to; i++) {
 		const Component *rup_ptr = &p_src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
 		Component *dst_ptr = &p_dst[i * dst_w * CC];
@@ -1699,6 +1823,37 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	}
 }
 
+struct ImageMipmapData {
+	const void *src = nullptr;
+	void *dst = nullptr;
+	uint32_t width = 0;
+	uint32_t height = 0;
+};
+
+template <typename Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap_rows(const ImageRowsTask &p_task, uint32_t p_from, uint32_t p_to) {
+	const ImageMipmapData *md = static_cast<const ImageMipmapData *>(p_task.userdata);
+	_generate_po2_mipmap<Component, CC, renormalize, average_func, renormalize_func>(static_cast<const Component *>(md->src), static_cast<Component *>(md->dst), md->width, md->height, p_from, p_to);
+}
+
+// Generates the next mipmap, with destination rows processed in parallel.
+template <typename Component, int CC, bool renormalize,
+		void (*average_func)(Component &, const Component &, const Component &, const Component &, const Component &),
+		void (*renormalize_func)(Component *)>
+static void _generate_po2_mipmap_threaded(const Component *p_src, Component *p_dst, uint32_t p_width, uint32_t p_height) {
+	ImageMipmapData md;
+	md.src = p_src;
+	md.dst = p_dst;
+	md.width = p_width;
+	md.height = p_height;
+
+	uint32_t dst_w = MAX(p_width >> 1, 1u);
+	uint32_t dst_h = MAX(p_height >> 1, 1u);
+	_image_process_rows(&_generate_po2_mipmap_rows<Component, CC, renormalize, average_func, renormalize_func>, &md, dst_h, (uint64_t)dst_w * dst_h);
+}
+
 void Image::shrink_x2() {
 	ERR_FAIL_COND(data.is_empty());
 
@@ -1739,49 +1894,49 @@ void Image::shrink_x2() {
 			switch (format) {
 				case FORMAT_L8:
 				case FORMAT_R8:
-					_generate_po2_mipmap<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
 					break;
 				case FORMAT_LA8:
-					_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
 					break;
 				case FORMAT_RG8:
-					_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
 					break;
 				case FORMAT_RGB8:
-					_generate_po2_mipmap<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
 					break;
 				case FORMAT_RGBA8:
-					_generate_po2_mipmap<uint8_t, 4, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
+					_generate_po2_mipmap_threaded<uint8_t, 4, false, Image::average_4_uint8, Image::renormalize_uint8>(r, w, width, height);
 					break;
 
 				case FORMAT_RF:
-					_generate_po2_mipmap<float, 1, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded<float, 1, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 				case FORMAT_RGF:
-					_generate_po2_mipmap<float, 2, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded<float, 2, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 				case FORMAT_RGBF:
-					_generate_po2_mipmap<float, 3, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded<float, 3, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 				case FORMAT_RGBAF:
-					_generate_po2_mipmap<float, 4, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
+					_generate_po2_mipmap_threaded<float, 4, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(r), reinterpret_cast<float *>(w), width, height);
 					break;
 
 				case FORMAT_RH:
-					_generate_po2_mipmap<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 				case FORMAT_RGH:
-					_generate_po2_mipmap<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 				case FORMAT_RGBH:
-					_generate_po2_mipmap<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 				case FORMAT_RGBAH:
-					_generate_po2_mipmap<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
+					_generate_po2_mipmap_threaded<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(r), reinterpret_cast<uint16_t *>(w), width, height);
 					break;
 
 				case FORMAT_RGBE9995:
-					_generate_po2_mipmap<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(r), reinterpret_cast<uint32_t *>(w), width, height);
+					_generate_po2_mipmap_threaded<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(r), reinterpret_cast<uint32_t *>(w), width, height);
 					break;
 				default: {
 				}
@@ -1843,76 +1998,76 @@ Error Image::generate_mipmaps(bool p_renormalize) {
 		switch (format) {
 			case FORMAT_L8:
 			case FORMAT_R8:
-				_generate_po2_mipmap<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+				_generate_po2_mipmap_threaded<uint8_t, 1, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				break;
 			case FORMAT_LA8:
 			case FORMAT_RG8:
-				_generate_po2_mipmap<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+				_generate_po2_mipmap_threaded<uint8_t, 2, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				break;
 			case FORMAT_RGB8:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint8_t, 3, true, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint8_t, 3, true, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint8_t, 3, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBA8:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint8_t, 4, true, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint8_t, 4, true, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint8_t, 4, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint8_t, 4, false, Image::average_4_uint8, Image::renormalize_uint8>(&wp[prev_ofs], &wp[ofs], prev_w, prev_h);
 				}
 				break;
 			case FORMAT_RF:
-				_generate_po2_mipmap<float, 1, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded<float, 1, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGF:
-				_generate_po2_mipmap<float, 2, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded<float, 2, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGBF:
 				if (p_renormalize) {
-					_generate_po2_mipmap<float, 3, true, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<float, 3, true, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<float, 3, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<float, 3, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBAF:
 				if (p_renormalize) {
-					_generate_po2_mipmap<float, 4, true, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<float, 4, true, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<float, 4, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<float, 4, false, Image::average_4_float, Image::renormalize_float>(reinterpret_cast<const float *>(&wp[prev_ofs]), reinterpret_cast<float *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RH:
-				_generate_po2_mipmap<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded<uint16_t, 1, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGH:
-				_generate_po2_mipmap<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+				_generate_po2_mipmap_threaded<uint16_t, 2, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				break;
 			case FORMAT_RGBH:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint16_t, 3, true, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint16_t, 3, true, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint16_t, 3, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBAH:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint16_t, 4, true, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint16_t, 4, true, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint16_t, 4, false, Image::average_4_half, Image::renormalize_half>(reinterpret_cast<const uint16_t *>(&wp[prev_ofs]), reinterpret_cast<uint16_t *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
 			case FORMAT_RGBE9995:
 				if (p_renormalize) {
-					_generate_po2_mipmap<uint32_t, 1, true, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint32_t, 1, true, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
 				} else {
-					_generate_po2_mipmap<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
+					_generate_po2_mipmap_threaded<uint32_t, 1, false, Image::average_4_rgbe9995, Image::renormalize_rgbe9995>(reinterpret_cast<const uint32_t *>(&wp[prev_ofs]), reinterpret_cast<uint32_t *>(&wp[ofs]), prev_w, prev_h);
 				}
 
 				break;
@@ -37,11 +37,15 @@
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
 #define print_bl(m_what) (void)(m_what)
 
+// Minimum amount of internal resources for their serialization to be split across threads.
+#define RESOURCE_PARALLEL_SERIALIZE_MIN 32
+
 enum {
 	//numbering must be different from variant, in case new variant types are added (variant must be always contiguous for jumptable optimization)
 	VARIANT_NIL = 1,
@@ -1547,7 +1551,7 @@ void ResourceFormatSaverBinaryInstance::_pad_buffer(Ref<FileAccess> f, int p_byt
 	}
 }
 
-void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint) {
+void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const Variant &p_property, const HashMap<Ref<Resource>, int> &resource_map, const HashMap<Ref<Resource>, int> &external_resources, const HashMap<StringName, int> &string_map, const PropertyInfo &p_hint) {
 	switch (p_property.get_type()) {
 		case Variant::NIL: {
 			f->store_32(VARIANT_NIL);
@@ -1773,15 +1777,17 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 			}
 			f->store_16(snc);
 			for (int i = 0; i < np.get_name_count(); i++) {
-				if (string_map.has(np.get_name(i))) {
-					f->store_32(string_map[np.get_name(i)]);
+				const int *string_index = string_map.getptr(np.get_name(i));
+				if (string_index) {
+					f->store_32(*string_index);
 				} else {
 					save_unicode_string(f, np.get_name(i), true);
 				}
 			}
 			for (int i = 0; i < np.get_subname_count(); i++) {
-				if (string_map.has(np.get_subname(i))) {
-					f->store_32(string_map[np.get_subname(i)]);
+				const int *string_index = string_map.getptr(np.get_subname(i));
+				if (string_index) {
+					f->store_32(*string_index);
 				} else {
 					save_unicode_string(f, np.get_subname(i), true);
 				}
@@ -1802,17 +1808,25 @@ void ResourceFormatSaverBinaryInstance::write_variant(Ref<FileAccess> f, const V
 				return; // Don't save it.
 			}
 
+			// The tables are only read here, resources may be serialized from several threads.
 			if (!res->is_built_in()) {
+				const int *external_index = external_resources.getptr(res);
+				if (!external_index) {
+					f->store_32(OBJECT_EMPTY);
+				}
+				ERR_FAIL_NULL_MSG(external_index, "External resource was not pre cached for the external resources section.");
+
 				f->store_32(OBJECT_EXTERNAL_RESOURCE_INDEX);
-				f->store_32(external_resources[res]);
+				f->store_32(*external_index);
 			} else {
-				if (!resource_map.has(res)) {
+				const int *internal_index = resource_map.getptr(res);
+				if (!internal_index) {
 					f->store_32(OBJECT_EMPTY);
-					ERR_FAIL_MSG("Resource was not pre cached for the resource section, most likely due to circular reference.");
 				}
+				ERR_FAIL_NULL_MSG(internal_index, "Resource was not pre cached for the resource section, most likely due to circular reference.");
 
 				f->store_32(OBJECT_INTERNAL_RESOURCE);
-				f->store_32(resource_map[res]);
+				f->store_32(*internal_index);
 				//internal resource
 			}
 
@@ -2080,6 +2094,79 @@ static String _resource_get_class(Ref<Resource> p_resource) {
 	}
 }
 
+// Growable in-memory file, used to serialize resources on several threads before writing them in order.
+class FileAccessResourceBuffer : public FileAccess {
+	LocalVector<uint8_t> data;
+	uint64_t pos = 0;
+
+public:
+	const uint8_t *ptr() const { return data.ptr(); }
+
+	virtual Error open_internal(const String &p_path, int p_mode_flags) override { return ERR_UNAVAILABLE; }
+	virtual bool is_open() const override { return true; }
+
+	virtual void seek(uint64_t p_position) override { pos = MIN(p_position, uint64_t(data.size())); }
+	virtual void seek_end(int64_t p_position) override { pos = CLAMP(int64_t(data.size()) + p_position, 0, int64_t(data.size())); }
+	virtual uint64_t get_position() const override { return pos; }
+	virtual uint64_t get_length() const override { return data.size(); }
+
+	virtual bool eof_reached() const override { return pos >= data.size(); }
+
+	virtual uint8_t get_8() const override { ERR_FAIL_V_MSG(0, "Resource buffers are write-only."); }
+
+	virtual Error get_error() const override { return OK; }
+
+	virtual void flush() override {}
+	virtual void store_8(uint8_t p_byte) override {
+		if (pos == data.size()) {
+			data.push_back(p_byte);
+		} else {
+			data[pos] = p_byte;
+		}
+		pos++;
+	}
+	virtual void store_buffer(const uint8_t *p_src, uint64_t p_length) override {
+		ERR_FAIL_COND(!p_src && p_length > 0);
+		if (pos + p_length > data.size()) {
+			data.resize(pos + p_length);
+		}
+		memcpy(data.ptr() + pos, p_src, p_length);
+		pos += p_length;
+	}
+
+	virtual bool file_exists(const String &p_name) override { return false; }
+
+	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
+	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
+	virtual Error _set_unix_permissions(const String &p_file, BitField<FileAccess::UnixPermissionFlags> p_permissions) override { return FAILED; }
+
+	virtual bool _get_hidden_attribute(const String &p_file) override { return false; }
+	virtual Error _set_hidden_attribute(const String &p_file, bool p_hidden) override { return ERR_UNAVAILABLE; }
+	virtual bool _get_read_only_attribute(const String &p_file) override { return false; }
+	virtual Error _set_read_only_attribute(const String &p_file, bool p_ro) override { return ERR_UNAVAILABLE; }
+
+	virtual void close() override {}
+};
+
+void ResourceFormatSaverBinaryInstance::_write_resource(Ref<FileAccess> f, const ResourceData &p_resource, const HashMap<Ref<Resource>, int> &resource_map) {
+	save_unicode_string(f, p_resource.type);
+	f->store_32(p_resource.properties.size());
+
+	for (const Property &p : p_resource.properties) {
+		f->store_32(p.name_idx);
+		write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+	}
+}
+
+void ResourceFormatSaverBinaryInstance::_serialize_resource(uint32_t p_index, ResourceSerializeData *p_data) {
+	// All the tables are complete at this point. write_variant() takes them as const, and reports missing entries.
+	Ref<FileAccessResourceBuffer> buffer;
+	buffer.instantiate();
+	buffer->set_big_endian(big_endian);
+	_write_resource(buffer, *p_data->resources[p_index], *p_data->resource_map);
+	p_data->buffers[p_index] = buffer;
+}
+
 Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
 	Error err;
 	Ref<FileAccess> f;
@@ -2295,14 +2382,30 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	Vector<uint64_t> ofs_table;
 
 	//now actually save the resources
-	for (const ResourceData &rd : resources) {
-		ofs_table.push_back(f->get_position());
-		save_unicode_string(f, rd.type);
-		f->store_32(rd.properties.size());
-
-		for (const Property &p : rd.properties) {
-			f->store_32(p.name_idx);
-			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	if (resources.size() >= RESOURCE_PARALLEL_SERIALIZE_MIN && wtp && wtp->get_thread_count() > 1 && WorkerThreadPool::get_thread_index() == -1) {
+		// Resources don't depend on each other once their indices are known,
+		// so serialize them into memory in parallel and write them out in order.
+		ResourceSerializeData serialize_data;
+		serialize_data.resource_map = &resource_map;
+		serialize_data.resources.reserve(resources.size());
+		for (const ResourceData &rd : resources) {
+			serialize_data.resources.push_back(&rd);
+		}
+		serialize_data.buffers.resize(resources.size());
+
+		WorkerThreadPool::GroupID group_task = wtp->add_template_group_task(this, &ResourceFormatSaverBinaryInstance::_serialize_resource, &serialize_data, serialize_data.resources.size(), -1, true, SNAME("SerializeResources"));
+		wtp->wait_for_group_task_completion(group_task);
+
+		for (const Ref<FileAccess> &buffer : serialize_data.buffers) {
+			Ref<FileAccessResourceBuffer> resource_buffer = buffer;
+			ofs_table.push_back(f->get_position());
+			f->store_buffer(resource_buffer->ptr(), resource_buffer->get_length());
+		}
+	} else {
+		for (const ResourceData &rd : resources) {
+			ofs_table.push_back(f->get_position());
+			_write_resource(f, rd, resource_map);
 		}
 	}
 
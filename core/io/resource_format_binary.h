@@ -34,6 +34,7 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -158,7 +159,15 @@ class ResourceFormatSaverBinaryInstance {
 		List<Property> properties;
 	};
 
+	struct ResourceSerializeData {
+		LocalVector<const ResourceData *> resources;
+		LocalVector<Ref<FileAccess>> buffers;
+		const HashMap<Ref<Resource>, int> *resource_map = nullptr;
+	};
+
 	static void _pad_buffer(Ref<FileAccess> f, int p_bytes);
+	void _write_resource(Ref<FileAccess> f, const ResourceData &p_resource, const HashMap<Ref<Resource>, int> &resource_map);
+	void _serialize_resource(uint32_t p_index, ResourceSerializeData *p_data);
 	void _find_resources(const Variant &p_variant, bool p_main = false);
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
 	int get_string_index(const String &p_string);
@@ -175,7 +184,7 @@ public:
 	};
 	Error save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags = 0);
 	Error set_uid(const String &p_path, ResourceUID::ID p_uid);
-	static void write_variant(Ref<FileAccess> f, const Variant &p_property, HashMap<Ref<Resource>, int> &resource_map, HashMap<Ref<Resource>, int> &external_resources, HashMap<StringName, int> &string_map, const PropertyInfo &p_hint = PropertyInfo());
+	static void write_variant(Ref<FileAccess> f, const Variant &p_property, const HashMap<Ref<Resource>, int> &resource_map, const HashMap<Ref<Resource>, int> &external_resources, const HashMap<StringName, int> &string_map, const PropertyInfo &p_hint = PropertyInfo());
 };
 
 class ResourceFormatSaverBinary : public ResourceFormatSaver {
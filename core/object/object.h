@@ -1000,6 +1000,21 @@ public:
 	virtual ~Object();
 };
 
+#ifdef DEBUG_ENABLED
+// Prevents the object from being freed by the methods called on it, see `Object::callp()`.
+struct _ObjectDebugLock {
+	Object *obj;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj = p_obj;
+		obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		obj->_lock_index.unref();
+	}
+};
+#endif
+
 bool predelete_handler(Object *p_object);
 void postinitialize_handler(Object *p_object);
 
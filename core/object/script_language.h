@@ -391,6 +391,8 @@ public:
 	virtual void reload_all_scripts() = 0;
 	virtual void reload_scripts(const Array &p_scripts, bool p_soft_reload) = 0;
 	virtual void reload_tool_script(const Ref<Script> &p_script, bool p_soft_reload) = 0;
+	// Hint that the scripts at the given paths are about to be loaded, so work can be done ahead of time (e.g. in parallel).
+	virtual void prepare_scripts(const Vector<String> &p_paths) {}
 	/* LOADER FUNCTIONS */
 
 	virtual void get_recognized_extensions(List<String> *p_extensions) const = 0;
@@ -35,11 +35,13 @@
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
 #include "core/templates/hashfuncs.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/search_array.h"
 #include "core/templates/vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/dictionary.h"
 #include "core/variant/variant.h"
+#include "core/variant/variant_internal.h"
 
 class ArrayPrivate {
 public:
@@ -49,6 +51,69 @@ public:
 	ContainerTypeValidate typed;
 };
 
+// Element comparisons used by the search methods. Integers and floats, which typed arrays
+// commonly hold, are compared directly instead of through `StringLikeVariantComparator`.
+struct _ArrayValueEquals {
+	const Variant &value;
+	_FORCE_INLINE_ bool operator()(const Variant &p_element) const {
+		return StringLikeVariantComparator::compare(p_element, value);
+	}
+};
+
+struct _ArrayIntEquals {
+	int64_t value;
+	_FORCE_INLINE_ bool operator()(const Variant &p_element) const {
+		return p_element.get_type() == Variant::INT && *VariantInternal::get_int(&p_element) == value;
+	}
+};
+
+struct _ArrayFloatEquals {
+	double value;
+	_FORCE_INLINE_ bool operator()(const Variant &p_element) const {
+		if (p_element.get_type() != Variant::FLOAT) {
+			return false;
+		}
+		const double element = *VariantInternal::get_float(&p_element);
+		return element == value || (Math::is_nan(element) && Math::is_nan(value));
+	}
+};
+
+template <typename Equals>
+static int _array_find(const Vector<Variant> &p_array, int p_from, const Equals &p_equals) {
+	const Variant *data = p_array.ptr();
+	const int size = p_array.size();
+	for (int i = p_from; i < size; i++) {
+		if (p_equals(data[i])) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+template <typename Equals>
+static int _array_rfind(const Vector<Variant> &p_array, int p_from, const Equals &p_equals) {
+	const Variant *data = p_array.ptr();
+	for (int i = p_from; i >= 0; i--) {
+		if (p_equals(data[i])) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+template <typename Equals>
+static int _array_count(const Vector<Variant> &p_array, const Equals &p_equals) {
+	const Variant *data = p_array.ptr();
+	const int size = p_array.size();
+	int amount = 0;
+	for (int i = 0; i < size; i++) {
+		if (p_equals(data[i])) {
+			amount++;
+		}
+	}
+	return amount;
+}
+
 void Array::_ref(const Array &p_from) const {
 	ArrayPrivate *_fp = p_from._p;
 
@@ -265,6 +330,10 @@ void Array::assign(const Array &p_array) {
 
 void Array::push_back(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_p->typed.accepts_as_is(p_value)) {
+		_p->array.push_back(p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "push_back"));
 	_p->array.push_back(value);
@@ -337,20 +406,18 @@ int Array::find(const Variant &p_value, int p_from) const {
 	Variant value = p_value;
 	ERR_FAIL_COND_V(!_p->typed.validate(value, "find"), -1);
 
-	int ret = -1;
-
 	if (p_from < 0 || size() == 0) {
-		return ret;
+		return -1;
 	}
 
-	for (int i = p_from; i < size(); i++) {
-		if (StringLikeVariantComparator::compare(_p->array[i], value)) {
-			ret = i;
-			break;
-		}
+	switch (value.get_type()) {
+		case Variant::INT:
+			return _array_find(_p->array, p_from, _ArrayIntEquals{ *VariantInternal::get_int(&value) });
+		case Variant::FLOAT:
+			return _array_find(_p->array, p_from, _ArrayFloatEquals{ *VariantInternal::get_float(&value) });
+		default:
+			return _array_find(_p->array, p_from, _ArrayValueEquals{ value });
 	}
-
-	return ret;
 }
 
 int Array::rfind(const Variant &p_value, int p_from) const {
@@ -369,13 +436,14 @@ int Array::rfind(const Variant &p_value, int p_from) const {
 		p_from = _p->array.size() - 1;
 	}
 
-	for (int i = p_from; i >= 0; i--) {
-		if (StringLikeVariantComparator::compare(_p->array[i], value)) {
-			return i;
-		}
+	switch (value.get_type()) {
+		case Variant::INT:
+			return _array_rfind(_p->array, p_from, _ArrayIntEquals{ *VariantInternal::get_int(&value) });
+		case Variant::FLOAT:
+			return _array_rfind(_p->array, p_from, _ArrayFloatEquals{ *VariantInternal::get_float(&value) });
+		default:
+			return _array_rfind(_p->array, p_from, _ArrayValueEquals{ value });
 	}
-
-	return -1;
 }
 
 int Array::count(const Variant &p_value) const {
@@ -385,14 +453,14 @@ int Array::count(const Variant &p_value) const {
 		return 0;
 	}
 
-	int amount = 0;
-	for (int i = 0; i < _p->array.size(); i++) {
-		if (StringLikeVariantComparator::compare(_p->array[i], value)) {
-			amount++;
-		}
+	switch (value.get_type()) {
+		case Variant::INT:
+			return _array_count(_p->array, _ArrayIntEquals{ *VariantInternal::get_int(&value) });
+		case Variant::FLOAT:
+			return _array_count(_p->array, _ArrayFloatEquals{ *VariantInternal::get_float(&value) });
+		default:
+			return _array_count(_p->array, _ArrayValueEquals{ value });
 	}
-
-	return amount;
 }
 
 bool Array::has(const Variant &p_value) const {
@@ -409,6 +477,10 @@ void Array::remove_at(int p_pos) {
 
 void Array::set(int p_idx, const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_p->typed.accepts_as_is(p_value)) {
+		operator[](p_idx) = p_value;
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "set"));
 
@@ -611,8 +683,39 @@ struct _ArrayVariantSort {
 	}
 };
 
+// Sorts the raw values of an array holding only elements of the given type in contiguous memory,
+// then writes them back in place. Returns false if some element has another type.
+template <typename T>
+static bool _sort_values(Vector<Variant> &p_array, Variant::Type p_type) {
+	const int size = p_array.size();
+	const Variant *src = p_array.ptr();
+	LocalVector<T> values;
+	values.resize(size);
+	for (int i = 0; i < size; i++) {
+		if (src[i].get_type() != p_type) {
+			return false;
+		}
+		values[i] = *VariantGetInternalPtr<T>::get_ptr(&src[i]);
+	}
+
+	values.sort();
+
+	Variant *dst = p_array.ptrw();
+	for (int i = 0; i < size; i++) {
+		*VariantGetInternalPtr<T>::get_ptr(&dst[i]) = values[i];
+	}
+	return true;
+}
+
 void Array::sort() {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	// Comparing the values of typed arrays of numbers directly gives the same order as `_ArrayVariantSort`.
+	if (_p->typed.type == Variant::INT && _sort_values<int64_t>(_p->array, Variant::INT)) {
+		return;
+	}
+	if (_p->typed.type == Variant::FLOAT && _sort_values<double>(_p->array, Variant::FLOAT)) {
+		return;
+	}
 	_p->array.sort_custom<_ArrayVariantSort>();
 }
 
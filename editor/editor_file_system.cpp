@@ -1594,6 +1594,25 @@ void EditorFileSystem::_update_script_classes() {
 		}
 	}
 
+	// Let languages prepare the scripts that are about to be loaded, e.g. to parse them in parallel.
+	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
+		ScriptLanguage *lang = ScriptServer::get_language(i);
+		if (!lang->supports_documentation()) {
+			continue;
+		}
+		Vector<String> paths;
+		for (const String &path : update_script_paths) {
+			int index = -1;
+			EditorFileSystemDirectory *efd = find_file(path, &index);
+			if (efd && index >= 0 && efd->files[index]->type == lang->get_type() && !ResourceCache::has(path)) {
+				paths.push_back(path);
+			}
+		}
+		if (!paths.is_empty()) {
+			lang->prepare_scripts(paths);
+		}
+	}
+
 	// Parse documentation second, as it requires the class names to be correct and registered
 	for (const String &path : update_script_paths) {
 		int index = -1;
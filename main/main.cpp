@@ -118,6 +118,7 @@
 
 #ifdef MODULE_GDSCRIPT_ENABLED
 #include "modules/gdscript/gdscript.h"
+#include "modules/gdscript/gdscript_sampling_profiler.h"
 #if defined(TOOLS_ENABLED) && !defined(GDSCRIPT_NO_LSP)
 #include "modules/gdscript/language_server/gdscript_language_server.h"
 #endif // TOOLS_ENABLED && !GDSCRIPT_NO_LSP
@@ -587,6 +588,10 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("-d, --debug", "Debug (local stdout debugger).\n");
 	print_help_option("-b, --breakpoints", "Breakpoint list as source::line comma-separated pairs, no spaces (use %%20 instead).\n");
 	print_help_option("--profiling", "Enable profiling in the script debugger.\n");
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+	print_help_option("--gdscript-profile <file>", "Sample GDScript call stacks and save them to <file> on exit, in the collapsed stack format used by flame graph tools.\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+	print_help_option("--gdscript-profile-rate <hz>", "Number of samples taken per second by --gdscript-profile (default: 1000).\n", CLI_OPTION_AVAILABILITY_TEMPLATE_DEBUG);
+#endif
 	print_help_option("--gpu-profile", "Show a GPU profile of the tasks that took the most time during frame rendering.\n");
 	print_help_option("--gpu-validation", "Enable graphics API validation layers for debugging.\n");
 #ifdef DEBUG_ENABLED
@@ -1696,6 +1701,29 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				goto error;
 			}
 #endif // TOOLS_ENABLED && MODULE_GDSCRIPT_ENABLED && !GDSCRIPT_NO_LSP
+#if defined(DEBUG_ENABLED) && defined(MODULE_GDSCRIPT_ENABLED)
+		} else if (I->get() == "--gdscript-profile") {
+			if (I->next()) {
+				GDScriptSamplingProfiler::command_line_path = I->next()->get();
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <file> argument for --gdscript-profile <file>.\n");
+				goto error;
+			}
+		} else if (I->get() == "--gdscript-profile-rate") {
+			if (I->next()) {
+				int rate = I->next()->get().to_int();
+				if (rate < 1 || rate > 1000000) {
+					OS::get_singleton()->print("<hz> argument for --gdscript-profile-rate <hz> must be between 1 and 1000000.\n");
+					goto error;
+				}
+				GDScriptSamplingProfiler::command_line_interval_usec = 1000000 / rate;
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <hz> argument for --gdscript-profile-rate <hz>.\n");
+				goto error;
+			}
+#endif // DEBUG_ENABLED && MODULE_GDSCRIPT_ENABLED
 		} else if (I->get() == "--" || I->get() == "++") {
 			adding_user_args = true;
 		} else {
@@ -30,11 +30,27 @@
 
 #include "image_compress_astcenc.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <astcenc.h>
 
+struct ASTCEncoderThreadData {
+	astcenc_context *context = nullptr;
+	astcenc_image *image = nullptr;
+	const astcenc_swizzle *swizzle = nullptr;
+	uint8_t *dest = nullptr;
+	size_t dest_len = 0;
+	LocalVector<astcenc_error> thread_status;
+};
+
+static void _compress_astc_thread(void *p_thread_data, uint32_t p_thread_index) {
+	ASTCEncoderThreadData *td = static_cast<ASTCEncoderThreadData *>(p_thread_data);
+	// astcenc splits the image in blocks internally, every thread takes blocks until none are left.
+	td->thread_status[p_thread_index] = astcenc_compress_image(td->context, td->image, td->swizzle, td->dest, td->dest_len, p_thread_index);
+}
+
 void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -115,7 +131,12 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	// Context allocation.
 
 	astcenc_context *context;
-	const unsigned int thread_count = 1; // Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
+	// Godot compresses multiple images each on a thread when importing, which is more efficient for large amount of images.
+	// When called from outside the thread pool (e.g. compressing a single texture at runtime), spread the blocks of the image across the pool instead.
+	unsigned int thread_count = 1;
+	if (WorkerThreadPool::get_thread_index() == -1) {
+		thread_count = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count());
+	}
 	status = astcenc_context_alloc(&config, thread_count, &context);
 	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
 			vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
@@ -156,7 +177,26 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 			ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
 		};
 
-		status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		if (thread_count > 1) {
+			ASTCEncoderThreadData td;
+			td.context = context;
+			td.image = &image;
+			td.swizzle = &swizzle;
+			td.dest = dest_mip_write;
+			td.dest_len = comp_len;
+			td.thread_status.resize(thread_count);
+
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_astc_thread, &td, thread_count, thread_count, true, SNAME("AstcencCompress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			status = ASTCENC_SUCCESS;
+			for (const astcenc_error thread_status : td.thread_status) {
+				if (thread_status != ASTCENC_SUCCESS) {
+					status = thread_status;
+				}
+			}
+		} else {
+			status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		}
 
 		ERR_BREAK_MSG(status != ASTCENC_SUCCESS,
 				vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
@@ -30,12 +30,90 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <ProcessDxtc.hpp>
 #include <ProcessRGB.hpp>
 
+struct EtcpakCompressionRowTask {
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	uint32_t blocks = 0;
+	int width = 0;
+};
+
+struct EtcpakCompressionJobQueue {
+	EtcpakType compress_type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const EtcpakCompressionRowTask *job_tasks = nullptr;
+	uint32_t num_tasks = 0;
+	uint32_t num_threads = 0;
+};
+
+static void _digest_row_task(EtcpakType p_compress_type, const EtcpakCompressionRowTask &p_row_task) {
+	const uint32_t *src = p_row_task.src;
+	uint64_t *dst = p_row_task.dst;
+	const uint32_t blocks = p_row_task.blocks;
+	const int width = p_row_task.width;
+
+	switch (p_compress_type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(src, dst, blocks, width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(src, dst, blocks, width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(src, dst, blocks, width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(src, dst, blocks, width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(src, dst, blocks, width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressDxt1Dither(src, dst, blocks, width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressDxt5(src, dst, blocks, width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(src, dst, blocks, width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(src, dst, blocks, width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
+static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
+	EtcpakCompressionJobQueue *job_queue = static_cast<EtcpakCompressionJobQueue *>(p_job_queue);
+	uint32_t num_tasks = job_queue->num_tasks;
+	uint32_t total_threads = job_queue->num_threads;
+	uint32_t start = p_index * num_tasks / total_threads;
+	uint32_t end = (p_index + 1 == total_threads) ? num_tasks : ((p_index + 1) * num_tasks / total_threads);
+
+	for (uint32_t i = start; i < end; i++) {
+		_digest_row_task(job_queue->compress_type, job_queue->job_tasks[i]);
+	}
+}
+
 EtcpakType _determine_etc_type(Image::UsedChannels p_channels) {
 	switch (p_channels) {
 		case Image::USED_CHANNELS_L:
@@ -187,7 +265,14 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 	uint8_t *dest_write = dest_data.ptrw();
 
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
-	Vector<uint32_t> padded_src;
+	LocalVector<Vector<uint32_t>> padded_src;
+	padded_src.resize(mip_count + 1);
+
+	// Size of a 4x4 block in uint64_t words (8 bytes for ETC1, ETC2 RGB, EAC R11, DXT1 and BC4, 16 for the others).
+	const int block_words = Image::get_image_data_size(4, 4, target_format, false) / 8;
+
+	// Every row of 4x4 blocks of every mip level is encoded independently, so they can be spread across threads.
+	Vector<EtcpakCompressionRowTask> tasks;
 
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
@@ -200,7 +285,7 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 		// Block size. Align stride to multiple of 4 (RGBA8).
 		int mip_w = (orig_mip_w + 3) & ~3;
 		int mip_h = (orig_mip_h + 3) & ~3;
-		const uint32_t blocks = mip_w * mip_h / 16;
+		const uint32_t blocks_per_row = mip_w / 4;
 
 		// Get mip data from source image for reading.
 		int src_mip_ofs = r_img->get_mipmap_offset(i);
@@ -208,8 +293,8 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 
 		// Pad textures to nearest block by smearing.
 		if (mip_w != orig_mip_w || mip_h != orig_mip_h) {
-			padded_src.resize(mip_w * mip_h);
-			uint32_t *ptrw = padded_src.ptrw();
+			padded_src[i].resize(mip_w * mip_h);
+			uint32_t *ptrw = padded_src[i].ptrw();
 			int x = 0, y = 0;
 			for (y = 0; y < orig_mip_h; y++) {
 				for (x = 0; x < orig_mip_w; x++) {
@@ -227,51 +312,37 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 				}
 			}
 			// Override the src_mip_read pointer to our temporary Vector.
-			src_mip_read = padded_src.ptr();
+			src_mip_read = padded_src[i].ptr();
 		}
 
-		switch (p_compresstype) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
+		for (int y_start = 0; y_start < mip_h; y_start += 4) {
+			EtcpakCompressionRowTask row_task;
+			row_task.src = src_mip_read + y_start * mip_w;
+			row_task.dst = dest_mip_write + (y_start / 4) * blocks_per_row * block_words;
+			row_task.blocks = blocks_per_row;
+			row_task.width = mip_w;
 
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
+			tasks.push_back(row_task);
+		}
+	}
 
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, mip_w);
-				break;
+	EtcpakCompressionJobQueue job_queue;
+	job_queue.compress_type = p_compresstype;
+	job_queue.job_tasks = tasks.ptr();
+	job_queue.num_tasks = static_cast<uint32_t>(tasks.size());
+	// Imports already compress each image on its own pool thread, so only spread the rows across the pool
+	// when called from outside it (e.g. compressing a single texture at runtime).
+	job_queue.num_threads = 1;
+	if (WorkerThreadPool::get_thread_index() == -1) {
+		job_queue.num_threads = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), job_queue.num_tasks);
+	}
 
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
+	if (job_queue.num_threads > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, job_queue.num_threads, -1, true, SNAME("Etcpak Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (const EtcpakCompressionRowTask &row_task : tasks) {
+			_digest_row_task(p_compresstype, row_task);
 		}
 	}
 
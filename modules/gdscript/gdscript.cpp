@@ -31,10 +31,12 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_warning.h"
 
@@ -53,6 +55,7 @@
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/os/os.h"
+#include "scene/main/node.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_paths.h"
@@ -754,13 +757,30 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	// Only the first compilation of a script can use the bytecode cache, reloads always parse the source again.
+	bool first_compilation = !is_valid() && !has_instances;
+	if (first_compilation && GDScriptByteCodeCache::load(this)) {
+		Error err = GDScriptCache::finish_compiling(path);
+		if (err == OK && (ScriptServer::is_scripting_enabled() || is_tool())) {
+			err = _static_init();
+		}
+		reloading = false;
+		return err;
+	}
+
 	valid = false;
-	GDScriptParser parser;
-	Error err;
-	if (!binary_tokens.is_empty()) {
-		err = parser.parse_binary(binary_tokens, path);
-	} else {
-		err = parser.parse(source, path, false);
+	// Reuse the tree parsed ahead of time by `GDScriptLanguage::prepare_scripts()`, if any.
+	uint32_t source_hash = binary_tokens.is_empty() ? source.hash() : hash_murmur3_buffer(binary_tokens.ptr(), binary_tokens.size());
+	Ref<GDScriptParserRef> preparsed = GDScriptCache::take_parsed_script(path, source_hash);
+	GDScriptParser local_parser;
+	GDScriptParser &parser = preparsed.is_valid() ? *preparsed->get_parser() : local_parser;
+	Error err = OK;
+	if (preparsed.is_null()) {
+		if (!binary_tokens.is_empty()) {
+			err = parser.parse_binary(binary_tokens, path);
+		} else {
+			err = parser.parse(source, path, false);
+		}
 	}
 	if (err) {
 		if (EngineDebugger::is_active()) {
@@ -808,6 +828,11 @@ Error GDScript::reload(bool p_keep_state) {
 		}
 	}
 
+	if (first_compilation) {
+		// Before `_static_init()`, so no state from running the script is stored.
+		GDScriptByteCodeCache::save(this, analyzer);
+	}
+
 #ifdef TOOLS_ENABLED
 	// Done after compilation because it needs the GDScript object's inner class GDScript objects,
 	// which are made by calling make_scripts() within compiler.compile() above.
@@ -1600,6 +1625,11 @@ bool GDScriptInstance::set(const StringName &p_name, const Variant &p_value) {
 	{
 		HashMap<StringName, GDScript::MemberInfo>::Iterator E = script->member_indices.find(p_name);
 		if (E) {
+#ifdef DEBUG_ENABLED
+			// Members of a node's script belong to its process thread group, like the node itself.
+			const Node *node = Object::cast_to<Node>(owner);
+			ERR_FAIL_COND_V_MSG(node && !node->is_accessible_from_caller_thread(), false, vformat(R"(Caller thread can't set the script member "%s" of this node (%s). Use call_deferred() or call_thread_group() instead.)", p_name, node->get_description()));
+#endif
 			const GDScript::MemberInfo *member = &E->value;
 			Variant value = p_value;
 			if (member->data_type.has_type && !member->data_type.is_type(value)) {
@@ -1673,6 +1703,10 @@ bool GDScriptInstance::get(const StringName &p_name, Variant &r_ret) const {
 	{
 		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
 		if (E) {
+#ifdef DEBUG_ENABLED
+			const Node *node = Object::cast_to<Node>(owner);
+			ERR_FAIL_COND_V_MSG(node && !node->is_readable_from_caller_thread(), false, vformat(R"(The script member "%s" of this node (%s) can only be read from either the main thread or a thread group. Use call_deferred() instead.)", p_name, node->get_description()));
+#endif
 			if (E->value.getter) {
 				Callable::CallError err;
 				r_ret = const_cast<GDScriptInstance *>(this)->callp(E->value.getter, nullptr, 0, err);
@@ -2166,6 +2200,31 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+	if (!Engine::get_singleton()->is_editor_hint() && GLOBAL_GET("gdscript/loading/parse_in_parallel")) {
+		// Parse the scripts the game is likely to load at startup in parallel, so their first load can skip parsing.
+		// Analysis and compilation still happen when each script is loaded.
+		Vector<String> paths;
+		List<StringName> global_classes;
+		ScriptServer::get_global_class_list(&global_classes);
+		for (const StringName &E : global_classes) {
+			if (ScriptServer::get_global_class_language(E) == get_name()) {
+				paths.push_back(ScriptServer::get_global_class_path(E));
+			}
+		}
+		for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+			if (E.value.path.get_extension() == get_extension()) {
+				paths.push_back(E.value.path);
+			}
+		}
+		prepare_scripts(paths);
+	}
+
+#ifdef DEBUG_ENABLED
+	if (!GDScriptSamplingProfiler::command_line_path.is_empty()) {
+		GDScriptSamplingProfiler::start(GDScriptSamplingProfiler::command_line_interval_usec);
+	}
+#endif
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2180,10 +2239,20 @@ String GDScriptLanguage::get_extension() const {
 }
 
 void GDScriptLanguage::finish() {
+#ifdef DEBUG_ENABLED
+	if (!GDScriptSamplingProfiler::command_line_path.is_empty()) {
+		GDScriptSamplingProfiler::stop();
+		if (GDScriptSamplingProfiler::save(GDScriptSamplingProfiler::command_line_path) == OK) {
+			print_line(vformat(R"(GDScript sampling profile saved to "%s".)", GDScriptSamplingProfiler::command_line_path));
+		}
+	}
+#endif
+
 	_call_stack.free();
 
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
+	GDScriptByteCodeCache::clear();
 
 	// Clear dependencies between scripts, to ensure cyclic references are broken
 	// (to avoid leaks at exit).
@@ -2548,9 +2617,16 @@ void GDScriptLanguage::reload_tool_script(const Ref<Script> &p_script, bool p_so
 	reload_scripts(scripts, p_soft_reload);
 }
 
+void GDScriptLanguage::prepare_scripts(const Vector<String> &p_paths) {
+	GDScriptCache::parse_scripts(p_paths);
+}
+
 void GDScriptLanguage::frame() {
 	calls = 0;
 
+	// Scripts parsed ahead of time that were not loaded by now are likely not needed.
+	GDScriptCache::clear_parsed_scripts();
+
 #ifdef DEBUG_ENABLED
 	if (profiling) {
 		MutexLock lock(mutex);
@@ -2793,6 +2869,9 @@ GDScriptLanguage::GDScriptLanguage() {
 		_debug_max_call_stack = 0;
 	}
 
+	GDScriptByteCodeCache::set_enabled(GLOBAL_DEF_RST("gdscript/bytecode_cache/enabled", false));
+	GLOBAL_DEF_RST("gdscript/loading/parse_in_parallel", false);
+
 #ifdef DEBUG_ENABLED
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/exclude_addons", true);
@@ -0,0 +1,19 @@
+"""Functions used to generate source files during build time"""
+
+
+def make_bytecode_hash_header(target, source, env):
+    import hashlib
+
+    # Any change to the bytecode layout, the VM or the cache format must invalidate cached bytecode,
+    # including in builds made outside of a Git checkout, where the engine version hash is empty.
+    sha = hashlib.sha256()
+    for src in source:
+        with open(str(src), "rb") as f:
+            sha.update(f.read())
+
+    with open(str(target[0]), "w", encoding="utf-8", newline="\n") as f:
+        f.write("/* THIS FILE IS GENERATED DO NOT EDIT */\n")
+        f.write("#ifndef GDSCRIPT_BYTECODE_HASH_GEN_H\n")
+        f.write("#define GDSCRIPT_BYTECODE_HASH_GEN_H\n\n")
+        f.write('#define GDSCRIPT_BYTECODE_HASH "%s"\n\n' % sha.hexdigest())
+        f.write("#endif // GDSCRIPT_BYTECODE_HASH_GEN_H\n")
@@ -0,0 +1,1793 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript.h"
+#include "gdscript_analyzer.h"
+#include "gdscript_bytecode_hash.gen.h"
+#include "gdscript_cache.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/os/os.h"
+#include "core/version.h"
+
+bool GDScriptByteCodeCache::enabled = false;
+Mutex GDScriptByteCodeCache::mutex;
+GDScriptByteCodeCache::SymbolTables *GDScriptByteCodeCache::symbol_tables = nullptr;
+String GDScriptByteCodeCache::environment_hash;
+int GDScriptByteCodeCache::environment_global_count = -1;
+
+static const char *cache_file_header = "GDBC";
+static const char *cache_dir = "user://gdscript_cache";
+
+void GDScriptByteCodeCache::Writer::put_8(uint8_t p_value) {
+	data.push_back(p_value);
+}
+
+void GDScriptByteCodeCache::Writer::put_32(uint32_t p_value) {
+	int ofs = data.size();
+	data.resize(ofs + 4);
+	encode_uint32(p_value, data.ptrw() + ofs);
+}
+
+void GDScriptByteCodeCache::Writer::put_buffer(const uint8_t *p_buffer, int p_length) {
+	if (p_length <= 0) {
+		return;
+	}
+	int ofs = data.size();
+	data.resize(ofs + p_length);
+	memcpy(data.ptrw() + ofs, p_buffer, p_length);
+}
+
+void GDScriptByteCodeCache::Writer::put_string(const String &p_string) {
+	CharString utf8 = p_string.utf8();
+	put_32(utf8.length());
+	put_buffer((const uint8_t *)utf8.get_data(), utf8.length());
+}
+
+uint8_t GDScriptByteCodeCache::Reader::get_8() {
+	if (error || position + 1 > length) {
+		error = true;
+		return 0;
+	}
+	return data[position++];
+}
+
+uint32_t GDScriptByteCodeCache::Reader::get_32() {
+	if (error || position + 4 > length) {
+		error = true;
+		return 0;
+	}
+	uint32_t value = decode_uint32(data + position);
+	position += 4;
+	return value;
+}
+
+String GDScriptByteCodeCache::Reader::get_string() {
+	uint32_t size = get_32();
+	if (error || size > (uint32_t)(length - position)) {
+		error = true;
+		return String();
+	}
+	String string;
+	string.parse_utf8((const char *)data + position, size);
+	position += size;
+	return string;
+}
+
+uint32_t GDScriptByteCodeCache::Reader::get_count(int p_min_element_size) {
+	uint32_t count = get_32();
+	if (error || (uint64_t)count * p_min_element_size > (uint64_t)(length - position)) {
+		error = true;
+		return 0;
+	}
+	return count;
+}
+
+const GDScriptByteCodeCache::SymbolTables &GDScriptByteCodeCache::_get_symbol_tables() {
+	MutexLock lock(mutex);
+
+	if (symbol_tables) {
+		return *symbol_tables;
+	}
+
+	// Reverse lookup of the validated function pointers referenced by the bytecode, so they can be stored by name.
+	symbol_tables = memnew(SymbolTables);
+
+	for (int i = 0; i < Variant::VARIANT_MAX; i++) {
+		Variant::Type type = (Variant::Type)i;
+
+		for (int op = 0; op < Variant::OP_MAX; op++) {
+			for (int j = 0; j < Variant::VARIANT_MAX; j++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator((Variant::Operator)op, type, (Variant::Type)j);
+				if (evaluator && !symbol_tables->operators.has(evaluator)) {
+					symbol_tables->operators.insert(evaluator, op | (i << 8) | (j << 16));
+				}
+			}
+		}
+
+		List<StringName> members;
+		Variant::get_member_list(type, &members);
+		for (const StringName &E : members) {
+			Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, E);
+			if (setter && !symbol_tables->setters.has(setter)) {
+				symbol_tables->setters.insert(setter, Pair<Variant::Type, StringName>(type, E));
+			}
+			Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, E);
+			if (getter && !symbol_tables->getters.has(getter)) {
+				symbol_tables->getters.insert(getter, Pair<Variant::Type, StringName>(type, E));
+			}
+		}
+
+		Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type);
+		if (keyed_setter && !symbol_tables->keyed_setters.has(keyed_setter)) {
+			symbol_tables->keyed_setters.insert(keyed_setter, type);
+		}
+		Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type);
+		if (keyed_getter && !symbol_tables->keyed_getters.has(keyed_getter)) {
+			symbol_tables->keyed_getters.insert(keyed_getter, type);
+		}
+		Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type);
+		if (indexed_setter && !symbol_tables->indexed_setters.has(indexed_setter)) {
+			symbol_tables->indexed_setters.insert(indexed_setter, type);
+		}
+		Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type);
+		if (indexed_getter && !symbol_tables->indexed_getters.has(indexed_getter)) {
+			symbol_tables->indexed_getters.insert(indexed_getter, type);
+		}
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(type, &methods);
+		for (const StringName &E : methods) {
+			Variant::ValidatedBuiltInMethod method = Variant::get_validated_builtin_method(type, E);
+			if (method && !symbol_tables->builtin_methods.has(method)) {
+				symbol_tables->builtin_methods.insert(method, Pair<Variant::Type, StringName>(type, E));
+			}
+		}
+
+		for (int j = 0; j < Variant::get_constructor_count(type); j++) {
+			Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(type, j);
+			if (constructor && !symbol_tables->constructors.has(constructor)) {
+				symbol_tables->constructors.insert(constructor, Pair<Variant::Type, int>(type, j));
+			}
+		}
+	}
+
+	List<StringName> utilities;
+	Variant::get_utility_function_list(&utilities);
+	for (const StringName &E : utilities) {
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(E);
+		if (utility && !symbol_tables->utilities.has(utility)) {
+			symbol_tables->utilities.insert(utility, E);
+		}
+	}
+
+	List<StringName> gds_utilities;
+	GDScriptUtilityFunctions::get_function_list(&gds_utilities);
+	for (const StringName &E : gds_utilities) {
+		GDScriptUtilityFunctions::FunctionPtr utility = GDScriptUtilityFunctions::get_function(E);
+		if (utility && !symbol_tables->gds_utilities.has(utility)) {
+			symbol_tables->gds_utilities.insert(utility, E);
+		}
+	}
+
+	return *symbol_tables;
+}
+
+String GDScriptByteCodeCache::_get_environment_hash() {
+	MutexLock lock(mutex);
+
+	// The bytecode refers to globals by index, and the analyzer resolves identifiers against global classes and
+	// autoloads, so a change to any of them invalidates the cache. They only change while the project starts.
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	if (environment_global_count == language->get_global_array_size()) {
+		return environment_hash;
+	}
+
+	Vector<String> entries;
+	for (const KeyValue<StringName, int> &E : language->get_global_map()) {
+		entries.push_back("global:" + String(E.key) + ":" + itos(E.value));
+	}
+
+	List<StringName> global_classes;
+	ScriptServer::get_global_class_list(&global_classes);
+	for (const StringName &E : global_classes) {
+		entries.push_back("class:" + String(E) + ":" + ScriptServer::get_global_class_path(E) + ":" + String(ScriptServer::get_global_class_base(E)));
+	}
+
+	for (const KeyValue<StringName, ProjectSettings::AutoloadInfo> &E : ProjectSettings::get_singleton()->get_autoload_list()) {
+		entries.push_back("autoload:" + String(E.key) + ":" + E.value.path + ":" + itos(E.value.is_singleton));
+	}
+
+	entries.sort();
+	environment_hash = String("\n").join(entries).sha256_text();
+	environment_global_count = language->get_global_array_size();
+	return environment_hash;
+}
+
+String GDScriptByteCodeCache::_get_cache_key(const GDScript *p_script) {
+	String source_hash;
+	if (!p_script->binary_tokens.is_empty()) {
+		unsigned char hash[32];
+		CryptoCore::sha256(p_script->binary_tokens.ptr(), p_script->binary_tokens.size(), hash);
+		source_hash = String::hex_encode_buffer(hash, 32);
+	} else {
+		source_hash = p_script->source.sha256_text();
+	}
+
+	String config;
+#ifdef DEBUG_ENABLED
+	config += "debug";
+#endif
+#ifdef TOOLS_ENABLED
+	config += "tools";
+#endif
+
+	// Builds made outside of a Git checkout have no version hash, so tell them apart by their executable instead.
+	String build_hash = VERSION_HASH;
+	if (build_hash.is_empty()) {
+		build_hash = itos(FileAccess::get_modified_time(OS::get_singleton()->get_executable_path()));
+	}
+
+	return vformat("%s|%s|%s|%s|%s|%s|%s", VERSION_FULL_BUILD, build_hash, GDSCRIPT_BYTECODE_HASH, config, p_script->path, source_hash, _get_environment_hash());
+}
+
+String GDScriptByteCodeCache::_get_cache_path(const GDScript *p_script) {
+	return String(cache_dir).path_join(p_script->path.md5_text() + ".cache");
+}
+
+bool GDScriptByteCodeCache::_can_use_cache(const GDScript *p_script) {
+	if (!enabled || Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+	// Breakpoints and warnings need the parser, and debug information is only generated for the debugger.
+	if (EngineDebugger::is_active()) {
+		return false;
+	}
+	return p_script->path.begins_with("res://") && !p_script->path.contains("::") && p_script->_owner == nullptr;
+}
+
+bool GDScriptByteCodeCache::_write_variant(Writer &p_writer, const Variant &p_variant, const GDScript *p_script) {
+	switch (p_variant.get_type()) {
+		case Variant::OBJECT: {
+			Object *obj = p_variant;
+			if (obj == nullptr) {
+				p_writer.put_8(TAG_NULL_OBJECT);
+				return true;
+			}
+			if (obj == p_script) {
+				p_writer.put_8(TAG_SELF);
+				return true;
+			}
+			GDScriptNativeClass *native_class = Object::cast_to<GDScriptNativeClass>(obj);
+			if (native_class) {
+				p_writer.put_8(TAG_NATIVE_CLASS);
+				p_writer.put_string(native_class->get_name());
+				return true;
+			}
+			Resource *resource = Object::cast_to<Resource>(obj);
+			if (resource && !Object::cast_to<Script>(obj) && !resource->is_built_in()) {
+				p_writer.put_8(TAG_RESOURCE);
+				p_writer.put_string(resource->get_path());
+				p_writer.put_string(resource->get_class());
+				return true;
+			}
+			// Other scripts and objects created at compile time can't be restored.
+			return false;
+		}
+		case Variant::ARRAY: {
+			Array array = p_variant;
+			p_writer.put_8(TAG_ARRAY);
+			Ref<Script> typed_script = array.get_typed_script();
+			if (typed_script.is_valid() && typed_script.ptr() != p_script) {
+				return false;
+			}
+			p_writer.put_8(array.is_read_only());
+			p_writer.put_8(array.is_typed());
+			p_writer.put_32(array.get_typed_builtin());
+			p_writer.put_string(array.get_typed_class_name());
+			p_writer.put_8(typed_script.is_valid());
+			p_writer.put_32(array.size());
+			for (int i = 0; i < array.size(); i++) {
+				if (!_write_variant(p_writer, array[i], p_script)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::DICTIONARY: {
+			Dictionary dictionary = p_variant;
+			p_writer.put_8(TAG_DICTIONARY);
+			p_writer.put_8(dictionary.is_read_only());
+			p_writer.put_32(dictionary.size());
+			List<Variant> keys;
+			dictionary.get_key_list(&keys);
+			for (const Variant &E : keys) {
+				if (!_write_variant(p_writer, E, p_script) || !_write_variant(p_writer, dictionary[E], p_script)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case Variant::RID:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+			return false;
+		default: {
+			int length = 0;
+			Error err = encode_variant(p_variant, nullptr, length);
+			ERR_FAIL_COND_V(err != OK, false);
+			p_writer.put_8(TAG_VALUE);
+			p_writer.put_32(length);
+			int ofs = p_writer.data.size();
+			p_writer.data.resize(ofs + length);
+			encode_variant(p_variant, p_writer.data.ptrw() + ofs, length);
+			return true;
+		}
+	}
+}
+
+bool GDScriptByteCodeCache::_read_variant(Reader &p_reader, Variant &r_variant, GDScript *p_script, int p_depth) {
+	if (p_depth > MAX_VARIANT_DEPTH) {
+		return false;
+	}
+
+	switch (p_reader.get_8()) {
+		case TAG_VALUE: {
+			uint32_t length = p_reader.get_count();
+			if (p_reader.error) {
+				return false;
+			}
+			int read = 0;
+			Error err = decode_variant(r_variant, p_reader.data + p_reader.position, length, &read);
+			if (err != OK || read != (int)length) {
+				return false;
+			}
+			p_reader.position += length;
+			return true;
+		}
+		case TAG_NULL_OBJECT: {
+			r_variant = (Object *)nullptr;
+			return true;
+		}
+		case TAG_SELF: {
+			r_variant = Ref<GDScript>(p_script);
+			return true;
+		}
+		case TAG_NATIVE_CLASS: {
+			StringName name = p_reader.get_string();
+			const int *idx = GDScriptLanguage::get_singleton()->get_global_map().getptr(name);
+			if (p_reader.error || idx == nullptr) {
+				return false;
+			}
+			const Variant &global = GDScriptLanguage::get_singleton()->get_global_array()[*idx];
+			GDScriptNativeClass *native_class = Object::cast_to<GDScriptNativeClass>(global);
+			if (native_class == nullptr || native_class->get_name() != name) {
+				return false;
+			}
+			r_variant = global;
+			return true;
+		}
+		case TAG_RESOURCE: {
+			String path = p_reader.get_string();
+			String type = p_reader.get_string();
+			if (p_reader.error) {
+				return false;
+			}
+			Ref<Resource> resource = ResourceLoader::load(path, type);
+			if (resource.is_null() || resource->is_class("Script")) {
+				return false;
+			}
+			r_variant = resource;
+			return true;
+		}
+		case TAG_ARRAY: {
+			bool read_only = p_reader.get_8();
+			bool typed = p_reader.get_8();
+			uint32_t typed_builtin = p_reader.get_32();
+			StringName typed_class_name = p_reader.get_string();
+			bool typed_self = p_reader.get_8();
+			uint32_t size = p_reader.get_count();
+			if (p_reader.error || typed_builtin >= Variant::VARIANT_MAX) {
+				return false;
+			}
+			Array array;
+			if (typed) {
+				array.set_typed(typed_builtin, typed_class_name, typed_self ? Variant(Ref<GDScript>(p_script)) : Variant());
+			}
+			array.resize(size);
+			for (uint32_t i = 0; i < size; i++) {
+				Variant element;
+				if (!_read_variant(p_reader, element, p_script, p_depth + 1)) {
+					return false;
+				}
+				array[i] = element;
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			r_variant = array;
+			return true;
+		}
+		case TAG_DICTIONARY: {
+			bool read_only = p_reader.get_8();
+			uint32_t size = p_reader.get_count(2);
+			if (p_reader.error) {
+				return false;
+			}
+			Dictionary dictionary;
+			for (uint32_t i = 0; i < size; i++) {
+				Variant key;
+				Variant value;
+				if (!_read_variant(p_reader, key, p_script, p_depth + 1) || !_read_variant(p_reader, value, p_script, p_depth + 1)) {
+					return false;
+				}
+				dictionary[key] = value;
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			r_variant = dictionary;
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+bool GDScriptByteCodeCache::_write_data_type(Writer &p_writer, const GDScriptDataType &p_type, const GDScript *p_script) {
+	if (p_type.kind == GDScriptDataType::SCRIPT || (p_type.kind == GDScriptDataType::GDSCRIPT && p_type.script_type != p_script)) {
+		return false;
+	}
+
+	p_writer.put_8(p_type.has_type);
+	p_writer.put_8(p_type.kind);
+	p_writer.put_32(p_type.builtin_type);
+	p_writer.put_string(p_type.native_type);
+	p_writer.put_32(p_type.container_element_types.size());
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		if (!_write_data_type(p_writer, element_type, p_script)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool GDScriptByteCodeCache::_read_data_type(Reader &p_reader, GDScriptDataType &r_type, GDScript *p_script, int p_depth) {
+	if (p_depth > MAX_VARIANT_DEPTH) {
+		return false;
+	}
+
+	r_type.has_type = p_reader.get_8();
+	uint8_t kind = p_reader.get_8();
+	uint32_t builtin_type = p_reader.get_32();
+	r_type.native_type = p_reader.get_string();
+	uint32_t element_count = p_reader.get_count();
+	if (p_reader.error || builtin_type >= Variant::VARIANT_MAX || kind == GDScriptDataType::SCRIPT || kind > GDScriptDataType::GDSCRIPT) {
+		return false;
+	}
+
+	r_type.kind = (GDScriptDataType::Kind)kind;
+	r_type.builtin_type = (Variant::Type)builtin_type;
+	if (r_type.kind == GDScriptDataType::NATIVE && !ClassDB::class_exists(r_type.native_type)) {
+		return false;
+	}
+	if (r_type.kind == GDScriptDataType::GDSCRIPT) {
+		// Local classes aren't referenced, see `GDScriptCompiler::_gdtype_from_datatype()`.
+		r_type.script_type = p_script;
+	}
+
+	for (uint32_t i = 0; i < element_count; i++) {
+		GDScriptDataType element_type;
+		if (!_read_data_type(p_reader, element_type, p_script, p_depth + 1)) {
+			return false;
+		}
+		r_type.container_element_types.push_back(element_type);
+	}
+	return true;
+}
+
+bool GDScriptByteCodeCache::_write_function(Writer &p_writer, const GDScriptFunction *p_function, const GDScript *p_script) {
+	if (p_function->_lambdas_count > 0 || !p_function->stack_debug.is_empty()) {
+		return false;
+	}
+
+	const SymbolTables &tables = _get_symbol_tables();
+
+	p_writer.put_string(p_function->name);
+	p_writer.put_8(p_function->_static);
+	if (!_write_variant(p_writer, p_function->rpc_config, p_script)) {
+		return false;
+	}
+	if (!_write_data_type(p_writer, p_function->return_type, p_script)) {
+		return false;
+	}
+	p_writer.put_32(p_function->argument_types.size());
+	for (const GDScriptDataType &argument_type : p_function->argument_types) {
+		if (!_write_data_type(p_writer, argument_type, p_script)) {
+			return false;
+		}
+	}
+	if (!_write_variant(p_writer, Dictionary(p_function->method_info), p_script)) {
+		return false;
+	}
+
+	p_writer.put_32(p_function->_initial_line);
+	p_writer.put_32(p_function->_argument_count);
+	p_writer.put_32(p_function->_stack_size);
+	p_writer.put_32(p_function->_instruction_args_size);
+	p_writer.put_32(p_function->_member_caches_count);
+#ifdef DEBUG_ENABLED
+	p_writer.put_string(p_function->profile.signature);
+#endif
+
+	p_writer.put_32(p_function->temporary_slots.size());
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		p_writer.put_32(E.key);
+		p_writer.put_32(E.value);
+	}
+
+	p_writer.put_32(p_function->code.size());
+	for (int i = 0; i < p_function->code.size(); i++) {
+		p_writer.put_32(p_function->code[i]);
+	}
+
+	p_writer.put_32(p_function->default_arguments.size());
+	for (int i = 0; i < p_function->default_arguments.size(); i++) {
+		p_writer.put_32(p_function->default_arguments[i]);
+	}
+
+	p_writer.put_32(p_function->constants.size());
+	for (int i = 0; i < p_function->constants.size(); i++) {
+		if (!_write_variant(p_writer, p_function->constants[i], p_script)) {
+			return false;
+		}
+	}
+
+	p_writer.put_32(p_function->global_names.size());
+	for (int i = 0; i < p_function->global_names.size(); i++) {
+		p_writer.put_string(p_function->global_names[i]);
+	}
+
+	p_writer.put_32(p_function->operator_funcs.size());
+	for (int i = 0; i < p_function->operator_funcs.size(); i++) {
+		const RBMap<Variant::ValidatedOperatorEvaluator, uint32_t>::Element *op = tables.operators.find(p_function->operator_funcs[i]);
+		if (op == nullptr) {
+			return false;
+		}
+		p_writer.put_32(op->value());
+	}
+
+	p_writer.put_32(p_function->setters.size());
+	for (int i = 0; i < p_function->setters.size(); i++) {
+		const RBMap<Variant::ValidatedSetter, Pair<Variant::Type, StringName>>::Element *setter = tables.setters.find(p_function->setters[i]);
+		if (setter == nullptr) {
+			return false;
+		}
+		p_writer.put_32(setter->value().first);
+		p_writer.put_string(setter->value().second);
+	}
+
+	p_writer.put_32(p_function->getters.size());
+	for (int i = 0; i < p_function->getters.size(); i++) {
+		const RBMap<Variant::ValidatedGetter, Pair<Variant::Type, StringName>>::Element *getter = tables.getters.find(p_function->getters[i]);
+		if (getter == nullptr) {
+			return false;
+		}
+		p_writer.put_32(getter->value().first);
+		p_writer.put_string(getter->value().second);
+	}
+
+	p_writer.put_32(p_function->keyed_setters.size());
+	for (int i = 0; i < p_function->keyed_setters.size(); i++) {
+		const RBMap<Variant::ValidatedKeyedSetter, Variant::Type>::Element *type = tables.keyed_setters.find(p_function->keyed_setters[i]);
+		if (type == nullptr) {
+			return false;
+		}
+		p_writer.put_32(type->value());
+	}
+
+	p_writer.put_32(p_function->keyed_getters.size());
+	for (int i = 0; i < p_function->keyed_getters.size(); i++) {
+		const RBMap<Variant::ValidatedKeyedGetter, Variant::Type>::Element *type = tables.keyed_getters.find(p_function->keyed_getters[i]);
+		if (type == nullptr) {
+			return false;
+		}
+		p_writer.put_32(type->value());
+	}
+
+	p_writer.put_32(p_function->indexed_setters.size());
+	for (int i = 0; i < p_function->indexed_setters.size(); i++) {
+		const RBMap<Variant::ValidatedIndexedSetter, Variant::Type>::Element *type = tables.indexed_setters.find(p_function->indexed_setters[i]);
+		if (type == nullptr) {
+			return false;
+		}
+		p_writer.put_32(type->value());
+	}
+
+	p_writer.put_32(p_function->indexed_getters.size());
+	for (int i = 0; i < p_function->indexed_getters.size(); i++) {
+		const RBMap<Variant::ValidatedIndexedGetter, Variant::Type>::Element *type = tables.indexed_getters.find(p_function->indexed_getters[i]);
+		if (type == nullptr) {
+			return false;
+		}
+		p_writer.put_32(type->value());
+	}
+
+	p_writer.put_32(p_function->builtin_methods.size());
+	for (int i = 0; i < p_function->builtin_methods.size(); i++) {
+		const RBMap<Variant::ValidatedBuiltInMethod, Pair<Variant::Type, StringName>>::Element *method = tables.builtin_methods.find(p_function->builtin_methods[i]);
+		if (method == nullptr) {
+			return false;
+		}
+		p_writer.put_32(method->value().first);
+		p_writer.put_string(method->value().second);
+	}
+
+	p_writer.put_32(p_function->constructors.size());
+	for (int i = 0; i < p_function->constructors.size(); i++) {
+		const RBMap<Variant::ValidatedConstructor, Pair<Variant::Type, int>>::Element *constructor = tables.constructors.find(p_function->constructors[i]);
+		if (constructor == nullptr) {
+			return false;
+		}
+		p_writer.put_32(constructor->value().first);
+		p_writer.put_32(constructor->value().second);
+	}
+
+	p_writer.put_32(p_function->utilities.size());
+	for (int i = 0; i < p_function->utilities.size(); i++) {
+		const RBMap<Variant::ValidatedUtilityFunction, StringName>::Element *utility = tables.utilities.find(p_function->utilities[i]);
+		if (utility == nullptr) {
+			return false;
+		}
+		p_writer.put_string(utility->value());
+	}
+
+	p_writer.put_32(p_function->gds_utilities.size());
+	for (int i = 0; i < p_function->gds_utilities.size(); i++) {
+		const RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName>::Element *utility = tables.gds_utilities.find(p_function->gds_utilities[i]);
+		if (utility == nullptr) {
+			return false;
+		}
+		p_writer.put_string(utility->value());
+	}
+
+	p_writer.put_32(p_function->methods.size());
+	for (int i = 0; i < p_function->methods.size(); i++) {
+		const MethodBind *method = p_function->methods[i];
+		p_writer.put_string(method->get_instance_class());
+		p_writer.put_string(method->get_name());
+		p_writer.put_32(method->get_hash());
+	}
+
+	return true;
+}
+
+bool GDScriptByteCodeCache::_is_valid_address(const GDScriptFunction *p_function, int p_address, int p_member_count) {
+	int address_type = (p_address & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS;
+	int address_index = p_address & GDScriptFunction::ADDR_MASK;
+	switch (address_type) {
+		case GDScriptFunction::ADDR_TYPE_STACK:
+			return address_index < p_function->_stack_size;
+		case GDScriptFunction::ADDR_TYPE_CONSTANT:
+			return address_index < p_function->_constant_count;
+		case GDScriptFunction::ADDR_TYPE_MEMBER:
+			// Static functions run without an instance, so they have no members to address.
+			return !p_function->_static && address_index < p_member_count;
+	}
+	return false;
+}
+
+bool GDScriptByteCodeCache::_validate_code(GDScriptFunction *p_function, int p_member_count) {
+	// Release builds don't check the bytecode while running it, so everything the VM reads is checked here against
+	// the layout written by `GDScriptByteCodeGenerator`. See `GDScriptFunction::disassemble()` for the same layout.
+	int *code = p_function->_code_ptr;
+	const int code_size = p_function->_code_size;
+	constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code);
+
+	if (p_function->_stack_size < GDScriptFunction::FIXED_ADDRESSES_MAX + p_function->_argument_count || p_function->_instruction_args_size < 0 || p_function->_instruction_args_size > code_size) {
+		return false;
+	}
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		if (E.key < GDScriptFunction::FIXED_ADDRESSES_MAX || E.key >= p_function->_stack_size) {
+			return false;
+		}
+	}
+
+	Vector<bool> instruction_starts;
+	instruction_starts.resize(code_size);
+	instruction_starts.fill(false);
+	Vector<int> jump_targets;
+	for (int i = 0; i < p_function->default_arguments.size(); i++) {
+		jump_targets.push_back(p_function->default_arguments[i]);
+	}
+
+#define CODE_FAIL_COND(m_cond) \
+	if (unlikely(m_cond)) {    \
+		return false;          \
+	}
+#define CHECK_SPACE(m_space) CODE_FAIL_COND((m_space) > code_size - ip)
+#define CHECK_ADDRESS(m_ofs) CODE_FAIL_COND(!_is_valid_address(p_function, code[ip + (m_ofs)], p_member_count))
+#define CHECK_INDEX(m_ofs, m_count) CODE_FAIL_COND(code[ip + (m_ofs)] < 0 || code[ip + (m_ofs)] >= (m_count))
+#define CHECK_TYPE(m_ofs) CHECK_INDEX(m_ofs, Variant::VARIANT_MAX)
+#define CHECK_GLOBAL_NAME(m_ofs) CHECK_INDEX(m_ofs, p_function->_global_names_count)
+// Checks the argument count of a call or construction, followed by the given number of extra arguments.
+#define CHECK_ARGC(m_ofs, m_extra) CODE_FAIL_COND(code[ip + (m_ofs)] < 0 || code[ip + (m_ofs)] > instr_arg_count - (m_extra))
+#define ADD_JUMP(m_ofs) jump_targets.push_back(code[ip + (m_ofs)])
+
+	int ip = 0;
+	while (ip < code_size) {
+		instruction_starts.write[ip] = true;
+		int incr = 0;
+
+		// Instructions with a variable number of arguments store the count, then the addresses, then their operands.
+		int instr_arg_count = 0;
+		int ofs = 0;
+		const int opcode = code[ip];
+		switch (opcode) {
+			case GDScriptFunction::OPCODE_CONSTRUCT:
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED:
+			case GDScriptFunction::OPCODE_CONSTRUCT_ARRAY:
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_ARRAY:
+			case GDScriptFunction::OPCODE_CONSTRUCT_DICTIONARY:
+			case GDScriptFunction::OPCODE_CALL:
+			case GDScriptFunction::OPCODE_CALL_RETURN:
+			case GDScriptFunction::OPCODE_CALL_ASYNC:
+			case GDScriptFunction::OPCODE_CALL_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_GDSCRIPT_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_SELF_BASE:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_RET:
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_STATIC:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				CHECK_SPACE(2);
+				instr_arg_count = code[ip + 1];
+				CODE_FAIL_COND(instr_arg_count < 0 || instr_arg_count > p_function->_instruction_args_size);
+				CHECK_SPACE(2 + instr_arg_count);
+				for (int i = 0; i < instr_arg_count; i++) {
+					CHECK_ADDRESS(2 + i);
+				}
+				// Offset of the first operand after the arguments.
+				ofs = 2 + instr_arg_count;
+			} break;
+			default:
+				break;
+		}
+
+		switch (opcode) {
+			case GDScriptFunction::OPCODE_OPERATOR: {
+				CHECK_SPACE(7 + _pointer_size);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_ADDRESS(3);
+				CHECK_INDEX(4, Variant::OP_MAX);
+				// Clear the signature, return type and evaluator the VM caches in the instruction when it runs,
+				// they are only valid in the process that wrote them.
+				for (int i = 5; i < 7 + _pointer_size; i++) {
+					code[ip + i] = 0;
+				}
+				incr = 7 + _pointer_size;
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				CHECK_SPACE(5);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_ADDRESS(3);
+				CHECK_INDEX(4, p_function->_operator_funcs_count);
+				incr = 5;
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_ADD_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_LESS_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_GREATER_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT:
+			case GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_DIVIDE_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_ADD_VECTOR2:
+			case GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_VECTOR2:
+			case GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_VECTOR2_FLOAT:
+			case GDScriptFunction::OPCODE_OPERATOR_ADD_VECTOR3:
+			case GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_VECTOR3:
+			case GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT:
+			case GDScriptFunction::OPCODE_TYPE_TEST_SCRIPT:
+			case GDScriptFunction::OPCODE_SET_KEYED:
+			case GDScriptFunction::OPCODE_GET_KEYED:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_SCRIPT:
+			case GDScriptFunction::OPCODE_CAST_TO_NATIVE:
+			case GDScriptFunction::OPCODE_CAST_TO_SCRIPT: {
+				CHECK_SPACE(4);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_ADDRESS(3);
+				incr = 4;
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_BUILTIN:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+			case GDScriptFunction::OPCODE_CAST_TO_BUILTIN: {
+				CHECK_SPACE(4);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_TYPE(3);
+				incr = 4;
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_ARRAY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY: {
+				CHECK_SPACE(6);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_ADDRESS(3);
+				CHECK_TYPE(4);
+				CHECK_GLOBAL_NAME(5);
+				incr = 6;
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_NATIVE: {
+				CHECK_SPACE(4);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_GLOBAL_NAME(3);
+				incr = 4;
+			} break;
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED:
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED: {
+				CHECK_SPACE(5);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_ADDRESS(3);
+				int count = 0;
+				switch (opcode) {
+					case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED:
+						count = p_function->_keyed_setters_count;
+						break;
+					case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED:
+						count = p_function->_indexed_setters_count;
+						break;
+					case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED:
+						count = p_function->_keyed_getters_count;
+						break;
+					default:
+						count = p_function->_indexed_getters_count;
+						break;
+				}
+				CHECK_INDEX(4, count);
+				incr = 5;
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED:
+			case GDScriptFunction::OPCODE_GET_NAMED: {
+				CHECK_SPACE(5);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_GLOBAL_NAME(3);
+				CHECK_INDEX(4, p_function->_member_caches_count);
+				incr = 5;
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED:
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED: {
+				CHECK_SPACE(4);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_INDEX(3, opcode == GDScriptFunction::OPCODE_SET_NAMED_VALIDATED ? p_function->_setters_count : p_function->_getters_count);
+				incr = 4;
+			} break;
+			case GDScriptFunction::OPCODE_SET_MEMBER:
+			case GDScriptFunction::OPCODE_GET_MEMBER:
+			case GDScriptFunction::OPCODE_STORE_NAMED_GLOBAL: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				CHECK_GLOBAL_NAME(2);
+				if (opcode == GDScriptFunction::OPCODE_STORE_NAMED_GLOBAL) {
+					CODE_FAIL_COND(!GDScriptLanguage::get_singleton()->get_named_globals_map().has(p_function->_global_names_ptr[code[ip + 2]]));
+				}
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE:
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE:
+			case GDScriptFunction::OPCODE_AWAIT_RESUME:
+			case GDScriptFunction::OPCODE_RETURN: {
+				CHECK_SPACE(2);
+				CHECK_ADDRESS(1);
+				incr = 2;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT: {
+				CHECK_SPACE(ofs + 2);
+				CHECK_ARGC(ofs, 1);
+				CHECK_TYPE(ofs + 1);
+				incr = ofs + 2;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED: {
+				CHECK_SPACE(ofs + 2);
+				CHECK_ARGC(ofs, 1);
+				CHECK_INDEX(ofs + 1, p_function->_constructors_count);
+				incr = ofs + 2;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_ARRAY: {
+				CHECK_SPACE(ofs + 1);
+				CHECK_ARGC(ofs, 1);
+				incr = ofs + 1;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_ARRAY: {
+				CHECK_SPACE(ofs + 3);
+				CHECK_ARGC(ofs, 2);
+				CHECK_TYPE(ofs + 1);
+				CHECK_GLOBAL_NAME(ofs + 2);
+				incr = ofs + 3;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_DICTIONARY: {
+				CHECK_SPACE(ofs + 1);
+				// Keys and values are interleaved.
+				CODE_FAIL_COND(code[ip + ofs] < 0 || (int64_t)code[ip + ofs] * 2 > instr_arg_count - 1);
+				incr = ofs + 1;
+			} break;
+			case GDScriptFunction::OPCODE_CALL:
+			case GDScriptFunction::OPCODE_CALL_RETURN:
+			case GDScriptFunction::OPCODE_CALL_ASYNC: {
+				CHECK_SPACE(ofs + 3);
+				// The base and, when the call returns, the result follow the arguments.
+				CHECK_ARGC(ofs, opcode == GDScriptFunction::OPCODE_CALL ? 1 : 2);
+				CHECK_GLOBAL_NAME(ofs + 1);
+				CHECK_INDEX(ofs + 2, p_function->_member_caches_count);
+				incr = ofs + 3;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_RET:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				CHECK_SPACE(ofs + 2);
+				CHECK_ARGC(ofs, opcode == GDScriptFunction::OPCODE_CALL_METHOD_BIND ? 1 : 2);
+				CHECK_INDEX(ofs + 1, p_function->_methods_count);
+				incr = ofs + 2;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+				CHECK_SPACE(ofs + 2);
+				CHECK_ARGC(ofs, 2);
+				CHECK_INDEX(ofs + 1, p_function->_builtin_methods_count);
+				incr = ofs + 2;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_STATIC: {
+				CHECK_SPACE(ofs + 3);
+				CHECK_TYPE(ofs);
+				CHECK_GLOBAL_NAME(ofs + 1);
+				CHECK_ARGC(ofs + 2, 1);
+				incr = ofs + 3;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC: {
+				CHECK_SPACE(ofs + 2);
+				CHECK_INDEX(ofs, p_function->_methods_count);
+				CHECK_ARGC(ofs + 1, 1);
+				incr = ofs + 2;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+			case GDScriptFunction::OPCODE_CALL_GDSCRIPT_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_SELF_BASE: {
+				CHECK_SPACE(ofs + 2);
+				CHECK_ARGC(ofs, 1);
+				int count = 0;
+				switch (opcode) {
+					case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED:
+						count = p_function->_utilities_count;
+						break;
+					case GDScriptFunction::OPCODE_CALL_GDSCRIPT_UTILITY:
+						count = p_function->_gds_utilities_count;
+						break;
+					default:
+						count = p_function->_global_names_count;
+						break;
+				}
+				CHECK_INDEX(ofs + 1, count);
+				incr = ofs + 2;
+			} break;
+			case GDScriptFunction::OPCODE_AWAIT: {
+				// The VM reads the target of the `OPCODE_AWAIT_RESUME` that always follows.
+				CHECK_SPACE(4);
+				CHECK_ADDRESS(1);
+				CODE_FAIL_COND(code[ip + 2] != GDScriptFunction::OPCODE_AWAIT_RESUME);
+				incr = 2;
+			} break;
+			case GDScriptFunction::OPCODE_JUMP: {
+				CHECK_SPACE(2);
+				ADD_JUMP(1);
+				incr = 2;
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF:
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_JUMP_IF_SHARED: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				ADD_JUMP(2);
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+			case GDScriptFunction::OPCODE_BREAKPOINT:
+			case GDScriptFunction::OPCODE_END: {
+				incr = 1;
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				CHECK_TYPE(2);
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_ARRAY: {
+				CHECK_SPACE(5);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				CHECK_TYPE(3);
+				CHECK_GLOBAL_NAME(4);
+				incr = 5;
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_RETURN_TYPED_SCRIPT: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				CHECK_ADDRESS(2);
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_STORE_GLOBAL: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				CHECK_INDEX(2, GDScriptLanguage::get_singleton()->get_global_array_size());
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_ASSERT: {
+				CHECK_SPACE(3);
+				CHECK_ADDRESS(1);
+				// The message is optional.
+				if (code[ip + 2] != 0) {
+					CHECK_ADDRESS(2);
+				}
+				incr = 3;
+			} break;
+			case GDScriptFunction::OPCODE_LINE: {
+				CHECK_SPACE(2);
+				incr = 2;
+			} break;
+			default: {
+				if (opcode >= GDScriptFunction::OPCODE_ITERATE_BEGIN && opcode <= GDScriptFunction::OPCODE_ITERATE_OBJECT) {
+					CHECK_SPACE(5);
+					CHECK_ADDRESS(1);
+					CHECK_ADDRESS(2);
+					CHECK_ADDRESS(3);
+					ADD_JUMP(4);
+					incr = 5;
+				} else if (opcode >= GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL && opcode <= GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_COLOR_ARRAY) {
+					CHECK_SPACE(2);
+					CHECK_ADDRESS(1);
+					incr = 2;
+				} else {
+					// Unknown opcodes, and the static variable and lambda opcodes, which self-contained scripts don't use.
+					return false;
+				}
+			} break;
+		}
+
+		ip += incr;
+	}
+
+	for (int target : jump_targets) {
+		CODE_FAIL_COND(target < 0 || target >= code_size || !instruction_starts[target]);
+	}
+
+#undef ADD_JUMP
+#undef CHECK_ARGC
+#undef CHECK_GLOBAL_NAME
+#undef CHECK_TYPE
+#undef CHECK_INDEX
+#undef CHECK_ADDRESS
+#undef CHECK_SPACE
+#undef CODE_FAIL_COND
+
+	return true;
+}
+
+GDScriptFunction *GDScriptByteCodeCache::_read_function(Reader &p_reader, GDScript *p_script, int p_member_count) {
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+
+#define READ_FAIL_COND(m_cond)         \
+	if (unlikely(m_cond)) {            \
+		function->name = StringName(); \
+		memdelete(function);           \
+		return nullptr;                \
+	}
+
+	function->name = p_reader.get_string();
+	function->_static = p_reader.get_8();
+	READ_FAIL_COND(p_reader.error || !_read_variant(p_reader, function->rpc_config, p_script));
+	READ_FAIL_COND(!_read_data_type(p_reader, function->return_type, p_script));
+	uint32_t argument_count = p_reader.get_count();
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < argument_count; i++) {
+		GDScriptDataType argument_type;
+		READ_FAIL_COND(!_read_data_type(p_reader, argument_type, p_script));
+		function->argument_types.push_back(argument_type);
+	}
+	Variant method_info;
+	READ_FAIL_COND(!_read_variant(p_reader, method_info, p_script) || method_info.get_type() != Variant::DICTIONARY);
+	function->method_info = MethodInfo::from_dict(method_info);
+
+	function->_initial_line = p_reader.get_32();
+	function->_argument_count = p_reader.get_32();
+	function->_stack_size = p_reader.get_32();
+	function->_instruction_args_size = p_reader.get_32();
+	uint32_t member_caches_count = p_reader.get_32();
+#ifdef DEBUG_ENABLED
+	function->profile.signature = p_reader.get_string();
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+#endif
+	READ_FAIL_COND(p_reader.error || function->_argument_count != (int)argument_count);
+
+	uint32_t count = p_reader.get_count(8);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		int slot = p_reader.get_32();
+		uint32_t type = p_reader.get_32();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		function->temporary_slots[slot] = (Variant::Type)type;
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error || count == 0);
+	function->code.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		function->code.write[i] = p_reader.get_32();
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	function->default_arguments.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		function->default_arguments.write[i] = p_reader.get_32();
+	}
+
+	count = p_reader.get_count();
+	READ_FAIL_COND(p_reader.error);
+	function->constants.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		READ_FAIL_COND(!_read_variant(p_reader, function->constants.write[i], p_script));
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	function->global_names.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		function->global_names.write[i] = p_reader.get_string();
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t op = p_reader.get_32();
+		Variant::Operator op_type = (Variant::Operator)(op & 0xFF);
+		Variant::Type type_a = (Variant::Type)((op >> 8) & 0xFF);
+		Variant::Type type_b = (Variant::Type)((op >> 16) & 0xFF);
+		READ_FAIL_COND(op_type >= Variant::OP_MAX || type_a >= Variant::VARIANT_MAX || type_b >= Variant::VARIANT_MAX);
+		Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(op_type, type_a, type_b);
+		READ_FAIL_COND(evaluator == nullptr);
+		function->operator_funcs.push_back(evaluator);
+#ifdef DEBUG_ENABLED
+		function->operator_names.push_back(Variant::get_operator_name(op_type));
+#endif
+	}
+
+	count = p_reader.get_count(8);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		StringName member = p_reader.get_string();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedSetter setter = Variant::get_member_validated_setter((Variant::Type)type, member);
+		READ_FAIL_COND(setter == nullptr);
+		function->setters.push_back(setter);
+#ifdef DEBUG_ENABLED
+		function->setter_names.push_back(member);
+#endif
+	}
+
+	count = p_reader.get_count(8);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		StringName member = p_reader.get_string();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedGetter getter = Variant::get_member_validated_getter((Variant::Type)type, member);
+		READ_FAIL_COND(getter == nullptr);
+		function->getters.push_back(getter);
+#ifdef DEBUG_ENABLED
+		function->getter_names.push_back(member);
+#endif
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedKeyedSetter setter = Variant::get_member_validated_keyed_setter((Variant::Type)type);
+		READ_FAIL_COND(setter == nullptr);
+		function->keyed_setters.push_back(setter);
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedKeyedGetter getter = Variant::get_member_validated_keyed_getter((Variant::Type)type);
+		READ_FAIL_COND(getter == nullptr);
+		function->keyed_getters.push_back(getter);
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedIndexedSetter setter = Variant::get_member_validated_indexed_setter((Variant::Type)type);
+		READ_FAIL_COND(setter == nullptr);
+		function->indexed_setters.push_back(setter);
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedIndexedGetter getter = Variant::get_member_validated_indexed_getter((Variant::Type)type);
+		READ_FAIL_COND(getter == nullptr);
+		function->indexed_getters.push_back(getter);
+	}
+
+	count = p_reader.get_count(8);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		StringName method_name = p_reader.get_string();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX);
+		Variant::ValidatedBuiltInMethod method = Variant::get_validated_builtin_method((Variant::Type)type, method_name);
+		READ_FAIL_COND(method == nullptr);
+		function->builtin_methods.push_back(method);
+#ifdef DEBUG_ENABLED
+		function->builtin_methods_names.push_back(method_name);
+#endif
+	}
+
+	count = p_reader.get_count(8);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t type = p_reader.get_32();
+		uint32_t index = p_reader.get_32();
+		READ_FAIL_COND(type >= Variant::VARIANT_MAX || index >= (uint32_t)Variant::get_constructor_count((Variant::Type)type));
+		Variant::ValidatedConstructor constructor = Variant::get_validated_constructor((Variant::Type)type, index);
+		READ_FAIL_COND(constructor == nullptr);
+		function->constructors.push_back(constructor);
+#ifdef DEBUG_ENABLED
+		function->constructors_names.push_back(Variant::get_type_name((Variant::Type)type));
+#endif
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		StringName utility_name = p_reader.get_string();
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(utility_name);
+		READ_FAIL_COND(utility == nullptr);
+		function->utilities.push_back(utility);
+#ifdef DEBUG_ENABLED
+		function->utilities_names.push_back(utility_name);
+#endif
+	}
+
+	count = p_reader.get_count(4);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		StringName utility_name = p_reader.get_string();
+		GDScriptUtilityFunctions::FunctionPtr utility = GDScriptUtilityFunctions::get_function(utility_name);
+		READ_FAIL_COND(utility == nullptr);
+		function->gds_utilities.push_back(utility);
+#ifdef DEBUG_ENABLED
+		function->gds_utilities_names.push_back(utility_name);
+#endif
+	}
+
+	count = p_reader.get_count(12);
+	READ_FAIL_COND(p_reader.error);
+	for (uint32_t i = 0; i < count; i++) {
+		StringName class_name = p_reader.get_string();
+		StringName method_name = p_reader.get_string();
+		uint32_t hash = p_reader.get_32();
+		READ_FAIL_COND(p_reader.error);
+		MethodBind *method = ClassDB::get_method(class_name, method_name);
+		// The hash covers the signature, so a method changed by an extension isn't called with the old arguments.
+		READ_FAIL_COND(method == nullptr || method->get_instance_class() != class_name || method->get_hash() != hash);
+		function->methods.push_back(method);
+	}
+
+	READ_FAIL_COND(p_reader.error);
+	// Every member cache is referenced by an instruction.
+	READ_FAIL_COND(member_caches_count > (uint32_t)function->code.size());
+
+	// Same as `GDScriptByteCodeGenerator::write_end()`.
+	function->_code_ptr = function->code.ptrw();
+	function->_code_size = function->code.size();
+	function->_constant_count = function->constants.size();
+	function->_constants_ptr = function->_constant_count ? function->constants.ptrw() : nullptr;
+	function->_global_names_count = function->global_names.size();
+	function->_global_names_ptr = function->_global_names_count ? function->global_names.ptr() : nullptr;
+	function->_default_arg_count = function->default_arguments.size() ? function->default_arguments.size() - 1 : 0;
+	function->_default_arg_ptr = function->default_arguments.size() ? function->default_arguments.ptr() : nullptr;
+	function->_operator_funcs_count = function->operator_funcs.size();
+	function->_operator_funcs_ptr = function->_operator_funcs_count ? function->operator_funcs.ptr() : nullptr;
+	function->_setters_count = function->setters.size();
+	function->_setters_ptr = function->_setters_count ? function->setters.ptr() : nullptr;
+	function->_getters_count = function->getters.size();
+	function->_getters_ptr = function->_getters_count ? function->getters.ptr() : nullptr;
+	function->_keyed_setters_count = function->keyed_setters.size();
+	function->_keyed_setters_ptr = function->_keyed_setters_count ? function->keyed_setters.ptr() : nullptr;
+	function->_keyed_getters_count = function->keyed_getters.size();
+	function->_keyed_getters_ptr = function->_keyed_getters_count ? function->keyed_getters.ptr() : nullptr;
+	function->_indexed_setters_count = function->indexed_setters.size();
+	function->_indexed_setters_ptr = function->_indexed_setters_count ? function->indexed_setters.ptr() : nullptr;
+	function->_indexed_getters_count = function->indexed_getters.size();
+	function->_indexed_getters_ptr = function->_indexed_getters_count ? function->indexed_getters.ptr() : nullptr;
+	function->_builtin_methods_count = function->builtin_methods.size();
+	function->_builtin_methods_ptr = function->_builtin_methods_count ? function->builtin_methods.ptr() : nullptr;
+	function->_constructors_count = function->constructors.size();
+	function->_constructors_ptr = function->_constructors_count ? function->constructors.ptr() : nullptr;
+	function->_utilities_count = function->utilities.size();
+	function->_utilities_ptr = function->_utilities_count ? function->utilities.ptr() : nullptr;
+	function->_gds_utilities_count = function->gds_utilities.size();
+	function->_gds_utilities_ptr = function->_gds_utilities_count ? function->gds_utilities.ptr() : nullptr;
+	function->_methods_count = function->methods.size();
+	function->_methods_ptr = function->_methods_count ? function->methods.ptrw() : nullptr;
+	function->_lambdas_count = 0;
+	function->_lambdas_ptr = nullptr;
+	if (member_caches_count) {
+		function->_member_caches = memnew_arr(GDScriptFunction::MemberCache, member_caches_count);
+		function->_member_caches_count = member_caches_count;
+	}
+
+	READ_FAIL_COND(!_validate_code(function, p_member_count));
+
+#undef READ_FAIL_COND
+
+	return function;
+}
+
+Vector<uint8_t> GDScriptByteCodeCache::serialize(const GDScript *p_script) {
+	ERR_FAIL_NULL_V(p_script, Vector<uint8_t>());
+
+	if (!p_script->valid || p_script->base.is_valid() || p_script->native.is_null() || !p_script->subclasses.is_empty() ||
+			!p_script->static_variables_indices.is_empty() || p_script->static_initializer || !p_script->lambda_info.is_empty()) {
+		return Vector<uint8_t>();
+	}
+
+	Writer writer;
+	writer.put_string(p_script->fully_qualified_name);
+	writer.put_string(p_script->local_name);
+	writer.put_string(p_script->global_name);
+	writer.put_string(p_script->simplified_icon_path);
+	writer.put_string(p_script->native->get_name());
+	writer.put_8(p_script->tool);
+
+	writer.put_32(p_script->member_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->member_indices) {
+		writer.put_string(E.key);
+		writer.put_32(E.value.index);
+		writer.put_string(E.value.setter);
+		writer.put_string(E.value.getter);
+		writer.put_8(p_script->members.has(E.key));
+		if (!_write_data_type(writer, E.value.data_type, p_script) || !_write_variant(writer, Dictionary(E.value.property_info), p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+
+	writer.put_32(p_script->constants.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		writer.put_string(E.key);
+		if (!_write_variant(writer, E.value, p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+
+	writer.put_32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		writer.put_string(E.key);
+		if (!_write_variant(writer, Dictionary(E.value), p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+
+	if (!_write_variant(writer, p_script->rpc_config, p_script)) {
+		return Vector<uint8_t>();
+	}
+
+#ifdef TOOLS_ENABLED
+	writer.put_32(p_script->member_default_values.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->member_default_values) {
+		writer.put_string(E.key);
+		if (!_write_variant(writer, E.value, p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+#endif
+
+	int function_count = p_script->member_functions.size() + (p_script->implicit_initializer ? 1 : 0) + (p_script->implicit_ready ? 1 : 0);
+	writer.put_32(function_count);
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		writer.put_8(ROLE_MEMBER);
+		if (!_write_function(writer, E.value, p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+	if (p_script->implicit_initializer) {
+		writer.put_8(ROLE_IMPLICIT_INITIALIZER);
+		if (!_write_function(writer, p_script->implicit_initializer, p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+	if (p_script->implicit_ready) {
+		writer.put_8(ROLE_IMPLICIT_READY);
+		if (!_write_function(writer, p_script->implicit_ready, p_script)) {
+			return Vector<uint8_t>();
+		}
+	}
+
+	return writer.data;
+}
+
+bool GDScriptByteCodeCache::deserialize(GDScript *p_script, const Vector<uint8_t> &p_data) {
+	ERR_FAIL_NULL_V(p_script, false);
+	ERR_FAIL_COND_V_MSG(p_script->valid || !p_script->member_functions.is_empty(), false, "Only scripts that were never compiled can be restored from the bytecode cache.");
+
+	Reader reader;
+	reader.data = p_data.ptr();
+	reader.length = p_data.size();
+
+	String fully_qualified_name = reader.get_string();
+	StringName local_name = reader.get_string();
+	StringName global_name = reader.get_string();
+	String simplified_icon_path = reader.get_string();
+	StringName native_name = reader.get_string();
+	bool tool = reader.get_8();
+	if (reader.error) {
+		return false;
+	}
+
+	const int *native_idx = GDScriptLanguage::get_singleton()->get_global_map().getptr(native_name);
+	if (native_idx == nullptr) {
+		return false;
+	}
+	Ref<GDScriptNativeClass> native = GDScriptLanguage::get_singleton()->get_global_array()[*native_idx];
+	if (native.is_null() || native->get_name() != native_name) {
+		return false;
+	}
+
+	HashMap<StringName, GDScript::MemberInfo> member_indices;
+	HashSet<StringName> members;
+	uint32_t count = reader.get_count();
+	for (uint32_t i = 0; i < count && !reader.error; i++) {
+		StringName name = reader.get_string();
+		GDScript::MemberInfo minfo;
+		minfo.index = reader.get_32();
+		minfo.setter = reader.get_string();
+		minfo.getter = reader.get_string();
+		bool is_member = reader.get_8();
+		Variant property_info;
+		if (reader.error || !_read_data_type(reader, minfo.data_type, p_script) || !_read_variant(reader, property_info, p_script) || property_info.get_type() != Variant::DICTIONARY) {
+			return false;
+		}
+		minfo.property_info = PropertyInfo::from_dict(property_info);
+		if (minfo.index < 0 || minfo.index >= (int)count) {
+			return false;
+		}
+		member_indices.insert(name, minfo);
+		if (is_member) {
+			members.insert(name);
+		}
+	}
+
+	HashMap<StringName, Variant> constants;
+	count = reader.get_count();
+	for (uint32_t i = 0; i < count && !reader.error; i++) {
+		StringName name = reader.get_string();
+		Variant value;
+		if (reader.error || !_read_variant(reader, value, p_script)) {
+			return false;
+		}
+		constants.insert(name, value);
+	}
+
+	HashMap<StringName, MethodInfo> signals;
+	count = reader.get_count();
+	for (uint32_t i = 0; i < count && !reader.error; i++) {
+		StringName name = reader.get_string();
+		Variant method_info;
+		if (reader.error || !_read_variant(reader, method_info, p_script) || method_info.get_type() != Variant::DICTIONARY) {
+			return false;
+		}
+		signals.insert(name, MethodInfo::from_dict(method_info));
+	}
+
+	Variant rpc_config;
+	if (reader.error || !_read_variant(reader, rpc_config, p_script) || rpc_config.get_type() != Variant::DICTIONARY) {
+		return false;
+	}
+
+#ifdef TOOLS_ENABLED
+	HashMap<StringName, Variant> member_default_values;
+	count = reader.get_count();
+	for (uint32_t i = 0; i < count && !reader.error; i++) {
+		StringName name = reader.get_string();
+		Variant value;
+		if (reader.error || !_read_variant(reader, value, p_script)) {
+			return false;
+		}
+		member_default_values.insert(name, value);
+	}
+#endif
+
+	Vector<GDScriptFunction *> functions;
+	Vector<FunctionRole> roles;
+	count = reader.get_count();
+	bool failed = reader.error;
+	for (uint32_t i = 0; i < count && !failed; i++) {
+		uint8_t role = reader.get_8();
+		GDScriptFunction *function = role <= ROLE_IMPLICIT_READY ? _read_function(reader, p_script, member_indices.size()) : nullptr;
+		if (function == nullptr) {
+			failed = true;
+			break;
+		}
+		functions.push_back(function);
+		roles.push_back((FunctionRole)role);
+	}
+
+	if (failed || reader.error || reader.position != reader.length) {
+		for (GDScriptFunction *function : functions) {
+			// Avoid erasing a function of the same name from the script.
+			function->name = StringName();
+			memdelete(function);
+		}
+		return false;
+	}
+
+	// Same state as set by `GDScriptCompiler::make_scripts()` and `GDScriptCompiler::_prepare_compilation()`.
+	p_script->fully_qualified_name = fully_qualified_name;
+	p_script->local_name = local_name;
+	p_script->global_name = global_name;
+	p_script->simplified_icon_path = simplified_icon_path;
+	p_script->tool = tool;
+	p_script->native = native;
+	p_script->base = Ref<GDScript>();
+	p_script->_base = nullptr;
+	p_script->member_indices = member_indices;
+	p_script->members = members;
+	p_script->constants = constants;
+	p_script->_signals = signals;
+	p_script->rpc_config = rpc_config;
+#ifdef TOOLS_ENABLED
+	p_script->member_default_values = member_default_values;
+#endif
+
+	for (int i = 0; i < functions.size(); i++) {
+		GDScriptFunction *function = functions[i];
+		switch (roles[i]) {
+			case ROLE_MEMBER: {
+				p_script->member_functions[function->name] = function;
+				if (function->name == GDScriptLanguage::get_singleton()->strings._init) {
+					p_script->initializer = function;
+				}
+			} break;
+			case ROLE_IMPLICIT_INITIALIZER: {
+				p_script->implicit_initializer = function;
+			} break;
+			case ROLE_IMPLICIT_READY: {
+				p_script->implicit_ready = function;
+			} break;
+		}
+	}
+
+	p_script->valid = true;
+	return true;
+}
+
+bool GDScriptByteCodeCache::load(GDScript *p_script) {
+	if (!_can_use_cache(p_script) || p_script->valid) {
+		return false;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(_get_cache_path(p_script), FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	Vector<uint8_t> file_data;
+	file_data.resize(f->get_length());
+	if (f->get_buffer(file_data.ptrw(), file_data.size()) != (uint64_t)file_data.size()) {
+		return false;
+	}
+	f.unref();
+
+	Reader reader;
+	reader.data = file_data.ptr();
+	reader.length = file_data.size();
+
+	if (reader.length < 8 || memcmp(reader.data, cache_file_header, 4) != 0) {
+		return false;
+	}
+	reader.position = 4;
+	if (reader.get_32() != FORMAT_VERSION || reader.get_string() != _get_cache_key(p_script)) {
+		return false;
+	}
+
+	uint32_t dependency_count = reader.get_count(8);
+	for (uint32_t i = 0; i < dependency_count && !reader.error; i++) {
+		String dependency = reader.get_string();
+		String md5 = reader.get_string();
+		if (reader.error || FileAccess::get_md5(ResourceLoader::path_remap(dependency)) != md5) {
+			return false;
+		}
+	}
+
+	String md5 = reader.get_string();
+	uint32_t size = reader.get_count();
+	if (reader.error || size != (uint32_t)(reader.length - reader.position)) {
+		return false;
+	}
+	unsigned char hash[16];
+	CryptoCore::md5(reader.data + reader.position, size, hash);
+	if (String::hex_encode_buffer(hash, 16) != md5) {
+		return false;
+	}
+
+	if (!deserialize(p_script, file_data.slice(reader.position))) {
+		return false;
+	}
+
+	print_verbose(vformat(R"(GDScript: Loaded "%s" from the bytecode cache.)", p_script->path));
+	return true;
+}
+
+void GDScriptByteCodeCache::save(const GDScript *p_script, GDScriptAnalyzer &p_analyzer) {
+	if (!_can_use_cache(p_script)) {
+		return;
+	}
+
+	Vector<uint8_t> data = serialize(p_script);
+	if (data.is_empty()) {
+		return;
+	}
+
+	// Constants are folded from the scripts this one depends on, and from the scripts those depend on.
+	HashSet<String> dependencies;
+	List<GDScriptAnalyzer *> pending;
+	pending.push_back(&p_analyzer);
+	while (!pending.is_empty()) {
+		GDScriptAnalyzer *analyzer = pending.front()->get();
+		pending.pop_front();
+		for (const KeyValue<String, Ref<GDScriptParserRef>> &E : analyzer->get_depended_parsers()) {
+			if (E.value.is_null()) {
+				return;
+			}
+			if (E.key == p_script->path || dependencies.has(E.key)) {
+				continue;
+			}
+			dependencies.insert(E.key);
+			if (E.value->get_status() > GDScriptParserRef::PARSED) {
+				pending.push_back(E.value->get_analyzer());
+			}
+		}
+	}
+
+	Writer writer;
+	writer.put_buffer((const uint8_t *)cache_file_header, 4);
+	writer.put_32(FORMAT_VERSION);
+	writer.put_string(_get_cache_key(p_script));
+	writer.put_32(dependencies.size());
+	for (const String &E : dependencies) {
+		String md5 = FileAccess::get_md5(ResourceLoader::path_remap(E));
+		if (md5.is_empty()) {
+			return;
+		}
+		writer.put_string(E);
+		writer.put_string(md5);
+	}
+	unsigned char hash[16];
+	CryptoCore::md5(data.ptr(), data.size(), hash);
+	writer.put_string(String::hex_encode_buffer(hash, 16));
+	writer.put_32(data.size());
+	writer.put_buffer(data.ptr(), data.size());
+
+	if (!DirAccess::dir_exists_absolute(cache_dir)) {
+		Error err = DirAccess::make_dir_recursive_absolute(cache_dir);
+		ERR_FAIL_COND_MSG(err != OK, vformat(R"(Can't create the GDScript bytecode cache folder "%s".)", cache_dir));
+	}
+
+	// Write to a temporary file first, so a run reading the cache never sees a partial file.
+	String path = _get_cache_path(p_script);
+	String temp_path = path + ".tmp" + itos(Thread::get_caller_id());
+	{
+		Ref<FileAccess> f = FileAccess::open(temp_path, FileAccess::WRITE);
+		ERR_FAIL_COND_MSG(f.is_null(), vformat(R"(Can't write the GDScript bytecode cache file "%s".)", temp_path));
+		f->store_buffer(writer.data.ptr(), writer.data.size());
+	}
+	if (FileAccess::exists(path)) {
+		DirAccess::remove_absolute(path);
+	}
+	Error err = DirAccess::rename_absolute(temp_path, path);
+	if (err != OK) {
+		DirAccess::remove_absolute(temp_path);
+	}
+}
+
+void GDScriptByteCodeCache::clear() {
+	MutexLock lock(mutex);
+	if (symbol_tables) {
+		memdelete(symbol_tables);
+		symbol_tables = nullptr;
+	}
+	environment_hash = String();
+	environment_global_count = -1;
+}
@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_BYTECODE_CACHE_H
+#define GDSCRIPT_BYTECODE_CACHE_H
+
+#include "gdscript_function.h"
+
+#include "core/os/mutex.h"
+#include "core/string/ustring.h"
+#include "core/templates/rb_map.h"
+#include "core/templates/vector.h"
+
+class GDScript;
+class GDScriptAnalyzer;
+
+// Stores the compiled bytecode of scripts in the user data folder, so later runs can load it instead of parsing,
+// analyzing and compiling the source again. Entries are keyed by the engine build, the script source, the sources
+// of the scripts it depends on and the global names known to the compiler, and any mismatch falls back to a full
+// compilation.
+//
+// Only self-contained scripts are cached: scripts extending a native class, without inner classes, lambdas or
+// static variables, whose types and constants don't reference other scripts. Other scripts are always compiled.
+class GDScriptByteCodeCache {
+	static constexpr uint32_t FORMAT_VERSION = 1;
+	static constexpr int MAX_VARIANT_DEPTH = 64;
+
+	enum VariantTag {
+		TAG_VALUE,
+		TAG_NULL_OBJECT,
+		TAG_SELF,
+		TAG_NATIVE_CLASS,
+		TAG_RESOURCE,
+		TAG_ARRAY,
+		TAG_DICTIONARY,
+	};
+
+	enum FunctionRole {
+		ROLE_MEMBER,
+		ROLE_IMPLICIT_INITIALIZER,
+		ROLE_IMPLICIT_READY,
+	};
+
+	struct Writer {
+		Vector<uint8_t> data;
+
+		void put_8(uint8_t p_value);
+		void put_32(uint32_t p_value);
+		void put_buffer(const uint8_t *p_buffer, int p_length);
+		void put_string(const String &p_string);
+	};
+
+	struct Reader {
+		const uint8_t *data = nullptr;
+		int length = 0;
+		int position = 0;
+		bool error = false;
+
+		uint8_t get_8();
+		uint32_t get_32();
+		String get_string();
+		// Reads an element count, failing if there aren't enough bytes left for that many elements.
+		uint32_t get_count(int p_min_element_size = 1);
+	};
+
+	struct SymbolTables {
+		RBMap<Variant::ValidatedOperatorEvaluator, uint32_t> operators;
+		RBMap<Variant::ValidatedSetter, Pair<Variant::Type, StringName>> setters;
+		RBMap<Variant::ValidatedGetter, Pair<Variant::Type, StringName>> getters;
+		RBMap<Variant::ValidatedKeyedSetter, Variant::Type> keyed_setters;
+		RBMap<Variant::ValidatedKeyedGetter, Variant::Type> keyed_getters;
+		RBMap<Variant::ValidatedIndexedSetter, Variant::Type> indexed_setters;
+		RBMap<Variant::ValidatedIndexedGetter, Variant::Type> indexed_getters;
+		RBMap<Variant::ValidatedBuiltInMethod, Pair<Variant::Type, StringName>> builtin_methods;
+		RBMap<Variant::ValidatedConstructor, Pair<Variant::Type, int>> constructors;
+		RBMap<Variant::ValidatedUtilityFunction, StringName> utilities;
+		RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName> gds_utilities;
+	};
+
+	static bool enabled;
+	static Mutex mutex;
+	static SymbolTables *symbol_tables;
+	static String environment_hash;
+	static int environment_global_count;
+
+	static const SymbolTables &_get_symbol_tables();
+	static String _get_environment_hash();
+	static String _get_cache_key(const GDScript *p_script);
+	static String _get_cache_path(const GDScript *p_script);
+	static bool _can_use_cache(const GDScript *p_script);
+
+	static bool _write_variant(Writer &p_writer, const Variant &p_variant, const GDScript *p_script);
+	static bool _read_variant(Reader &p_reader, Variant &r_variant, GDScript *p_script, int p_depth = 0);
+	static bool _write_data_type(Writer &p_writer, const GDScriptDataType &p_type, const GDScript *p_script);
+	static bool _read_data_type(Reader &p_reader, GDScriptDataType &r_type, GDScript *p_script, int p_depth = 0);
+	static bool _write_function(Writer &p_writer, const GDScriptFunction *p_function, const GDScript *p_script);
+	static bool _is_valid_address(const GDScriptFunction *p_function, int p_address, int p_member_count);
+	// Checks that the bytecode only references existing addresses, tables and instructions.
+	static bool _validate_code(GDScriptFunction *p_function, int p_member_count);
+	static GDScriptFunction *_read_function(Reader &p_reader, GDScript *p_script, int p_member_count);
+
+public:
+	static void set_enabled(bool p_enabled) { enabled = p_enabled; }
+	static bool is_enabled() { return enabled; }
+
+	// Returns the compiled state of the script, or an empty buffer if the script can't be cached.
+	static Vector<uint8_t> serialize(const GDScript *p_script);
+	// Restores a script that was never compiled from the output of `serialize()`.
+	static bool deserialize(GDScript *p_script, const Vector<uint8_t> &p_data);
+
+	// Called before compiling a script, returns whether it was restored from the cache.
+	static bool load(GDScript *p_script);
+	// Called after a successful compilation, stores the script if it can be cached.
+	static void save(const GDScript *p_script, GDScriptAnalyzer &p_analyzer);
+
+	static void clear();
+};
+
+#endif // GDSCRIPT_BYTECODE_CACHE_H
@@ -36,6 +36,7 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/vector.h"
 
 bool GDScriptParserRef::is_valid() const {
@@ -178,6 +179,7 @@ void GDScriptCache::remove_script(const String &p_path) {
 	singleton->dependencies.erase(p_path);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
+	singleton->preparsed.erase(p_path);
 }
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
@@ -354,6 +356,7 @@ Error GDScriptCache::finish_compiling(const String &p_owner) {
 	Ref<GDScript> script = get_cached_script(p_owner);
 	singleton->full_gdscript_cache[p_owner] = script;
 	singleton->shallow_gdscript_cache.erase(p_owner);
+	singleton->preparsed.erase(p_owner);
 
 	HashSet<String> depends = singleton->dependencies[p_owner];
 
@@ -383,6 +386,118 @@ void GDScriptCache::remove_static_script(const String &p_fqcn) {
 	singleton->static_gdscript_cache.erase(p_fqcn);
 }
 
+void GDScriptCache::_parse_script(uint32_t p_index, ParseTask *p_task) {
+	// Only reads and parses the file: the parser ref is not visible to other threads until all tasks are done.
+	GDScriptParserRef *ref = p_task->refs[p_index].ptr();
+	const String &remapped_path = p_task->remapped_paths[p_index];
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> tokens = get_binary_tokens(remapped_path);
+		ref->source_hash = hash_murmur3_buffer(tokens.ptr(), tokens.size());
+		ref->result = ref->parser->parse_binary(tokens, ref->path);
+	} else {
+		String source = get_source_code(remapped_path);
+		ref->source_hash = source.hash();
+		ref->result = ref->parser->parse(source, ref->path, false);
+	}
+}
+
+void GDScriptCache::parse_scripts(const Vector<String> &p_paths) {
+	if (singleton == nullptr) {
+		return;
+	}
+
+	ParseTask task;
+	{
+		MutexLock lock(singleton->mutex);
+
+		if (singleton->cleared) {
+			return;
+		}
+
+		for (const String &path : p_paths) {
+			if (singleton->parser_map.has(path) || singleton->full_gdscript_cache.has(path)) {
+				continue;
+			}
+			String remapped_path = ResourceLoader::path_remap(path);
+			if (!FileAccess::exists(remapped_path)) {
+				continue;
+			}
+
+			Ref<GDScriptParserRef> ref;
+			ref.instantiate();
+			ref->parser = memnew(GDScriptParser);
+			ref->path = path;
+			ref->status = GDScriptParserRef::PARSED;
+
+			task.refs.push_back(ref);
+			task.remapped_paths.push_back(remapped_path);
+		}
+	}
+
+	// Parse without holding the cache lock. Threaded loads running on the worker threads may need it,
+	// and waiting for the group doesn't run its tasks on this thread.
+	if (task.refs.size() < 2) {
+		// Not worth dispatching.
+		for (uint32_t i = 0; i < task.refs.size(); i++) {
+			singleton->_parse_script(i, &task);
+		}
+	} else {
+		// Fill the lazily initialized builtin type table before any parser can race on it.
+		GDScriptParser::get_builtin_type(StringName());
+
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(singleton, &GDScriptCache::_parse_script, &task, task.refs.size(), -1, true, SNAME("GDScriptParseScripts"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	}
+
+	MutexLock lock(singleton->mutex);
+
+	for (Ref<GDScriptParserRef> &ref : task.refs) {
+		// Scripts loaded meanwhile already have their own parser, this one is dropped.
+		if (singleton->cleared || singleton->parser_map.has(ref->path) || singleton->full_gdscript_cache.has(ref->path)) {
+			ref->path = String(); // So freeing it doesn't remove the other parser from the map.
+			continue;
+		}
+		singleton->parser_map[ref->path] = ref.ptr();
+		singleton->preparsed[ref->path] = ref;
+	}
+}
+
+Ref<GDScriptParserRef> GDScriptCache::take_parsed_script(const String &p_path, uint32_t p_source_hash) {
+	if (singleton == nullptr) {
+		return Ref<GDScriptParserRef>();
+	}
+
+	MutexLock lock(singleton->mutex);
+
+	Ref<GDScriptParserRef> ref;
+	if (!singleton->preparsed.has(p_path)) {
+		return ref;
+	}
+	ref = singleton->preparsed[p_path];
+	singleton->preparsed.erase(p_path);
+
+	// A parser another script depends on is analyzed through the parser map, so it can't be analyzed again by the caller.
+	if (ref->get_reference_count() > 1 || ref->status != GDScriptParserRef::PARSED || ref->result != OK || ref->source_hash != p_source_hash) {
+		return Ref<GDScriptParserRef>();
+	}
+
+	if (singleton->parser_map.has(p_path) && singleton->parser_map[p_path] == ref.ptr()) {
+		singleton->parser_map.erase(p_path);
+	}
+	// Don't let the destructor remove a parser created for the same path later.
+	ref->path = String();
+	return ref;
+}
+
+void GDScriptCache::clear_parsed_scripts() {
+	if (singleton == nullptr) {
+		return;
+	}
+
+	MutexLock lock(singleton->mutex);
+	singleton->preparsed.clear();
+}
+
 void GDScriptCache::clear() {
 	if (singleton == nullptr) {
 		return;
@@ -406,6 +521,7 @@ void GDScriptCache::clear() {
 	}
 
 	parser_map_refs.clear();
+	singleton->preparsed.clear();
 	singleton->parser_map.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
@@ -37,6 +37,7 @@
 #include "core/os/mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 
 class GDScriptAnalyzer;
 class GDScriptParser;
@@ -57,6 +58,8 @@ private:
 	Status status = EMPTY;
 	Error result = OK;
 	String path;
+	// Hash of the source or binary tokens, set by `GDScriptCache::parse_scripts()`.
+	uint32_t source_hash = 0;
 	bool cleared = false;
 
 	friend class GDScriptCache;
@@ -80,6 +83,8 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> full_gdscript_cache;
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
+	// Parsers created ahead of time by `parse_scripts()`, kept alive until the script is compiled.
+	HashMap<String, Ref<GDScriptParserRef>> preparsed;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -91,6 +96,13 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	struct ParseTask {
+		LocalVector<Ref<GDScriptParserRef>> refs;
+		LocalVector<String> remapped_paths;
+	};
+
+	void _parse_script(uint32_t p_index, ParseTask *p_task);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
@@ -103,6 +115,10 @@ public:
 	static Error finish_compiling(const String &p_owner);
 	static void add_static_script(Ref<GDScript> p_script);
 	static void remove_static_script(const String &p_fqcn);
+	static void parse_scripts(const Vector<String> &p_paths);
+	// Hands the parser created by `parse_scripts()` over to the caller, if nothing else used it and it parsed the same source.
+	static Ref<GDScriptParserRef> take_parsed_script(const String &p_path, uint32_t p_source_hash);
+	static void clear_parsed_scripts();
 
 	static void clear();
 
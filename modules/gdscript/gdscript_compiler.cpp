@@ -250,6 +250,59 @@ static bool _can_use_validate_call(const MethodBind *p_method, const Vector<GDSc
 	return true;
 }
 
+// Typed locals of value types always hold a value of their type, so an operation
+// assigning to one can write its result straight into it.
+static bool _can_operate_in_place(const GDScriptCodeGenerator::Address &p_target, Variant::Operator p_operator, const GDScriptCodeGenerator::Address &p_value) {
+	if (p_target.mode != GDScriptCodeGenerator::Address::LOCAL_VARIABLE) {
+		return false;
+	}
+	if (!p_target.type.has_type || p_target.type.kind != GDScriptDataType::BUILTIN || !p_value.type.has_type || p_value.type.kind != GDScriptDataType::BUILTIN) {
+		return false;
+	}
+
+	const Variant::Type target_type = p_target.type.builtin_type;
+	const Variant::Type value_type = p_value.type.builtin_type;
+	if ((p_operator == Variant::OP_DIVIDE || p_operator == Variant::OP_MODULE) && target_type == Variant::INT && value_type == Variant::INT) {
+		// Not validated, since it must check for division by zero.
+		return false;
+	}
+	if (Variant::get_operator_return_type(p_operator, target_type, value_type) != target_type || !Variant::get_validated_operator_evaluator(p_operator, target_type, value_type)) {
+		return false;
+	}
+
+	switch (target_type) {
+		case Variant::INT:
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR2I:
+		case Variant::VECTOR3:
+		case Variant::VECTOR3I:
+		case Variant::VECTOR4:
+		case Variant::VECTOR4I:
+		case Variant::COLOR:
+		case Variant::QUATERNION:
+			return true;
+		default:
+			return false;
+	}
+}
+
+// An array literal used only as the list of a `for` loop can't be reached by any code, so its
+// elements can be iterated directly instead of allocating an array on every execution.
+// Long literals are still constructed, since selecting an element takes a comparison per element.
+static constexpr int MAX_IN_PLACE_ITERATION_ELEMENTS = 8;
+
+static bool _can_iterate_array_literal_in_place(const GDScriptParser::ExpressionNode *p_list) {
+	if (p_list->type != GDScriptParser::Node::ARRAY || p_list->is_constant) {
+		return false;
+	}
+	if (p_list->get_datatype().has_container_element_type(0)) {
+		return false; // Typed arrays convert and validate their elements.
+	}
+	const int element_count = static_cast<const GDScriptParser::ArrayNode *>(p_list)->elements.size();
+	return element_count > 0 && element_count <= MAX_IN_PLACE_ITERATION_ELEMENTS;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer, const GDScriptCodeGenerator::Address &p_index_addr) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -1308,7 +1361,11 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 
 				GDScriptCodeGenerator::Address to_assign;
 				bool has_operation = assignment->operation != GDScriptParser::AssignmentNode::OP_NONE;
-				if (has_operation) {
+				bool operated_in_place = false;
+				if (has_operation && !is_member && !assignment->use_conversion_assign && _can_operate_in_place(target, assignment->variant_op, assigned_value)) {
+					gen->write_binary_operator(target, assignment->variant_op, target, assigned_value);
+					operated_in_place = true;
+				} else if (has_operation) {
 					// Perform operation.
 					GDScriptCodeGenerator::Address op_result = codegen.add_temporary(_gdtype_from_datatype(assignment->get_datatype(), codegen.script));
 					GDScriptCodeGenerator::Address og_value = _parse_expression(codegen, r_error, assignment->assignee);
@@ -1322,7 +1379,9 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					to_assign = assigned_value;
 				}
 
-				if (has_setter && !is_in_setter) {
+				if (operated_in_place) {
+					// The result is already stored in the local.
+				} else if (has_setter && !is_in_setter) {
 					// Call setter.
 					Vector<GDScriptCodeGenerator::Address> args;
 					args.push_back(to_assign);
@@ -1851,6 +1910,76 @@ void GDScriptCompiler::_clear_addresses(CodeGen &codegen, const List<GDScriptCod
 	}
 }
 
+Error GDScriptCompiler::_parse_for_array_literal(CodeGen &codegen, const GDScriptParser::ForNode *p_for, const GDScriptCodeGenerator::Address &p_variable) {
+	const GDScriptParser::ArrayNode *an = static_cast<const GDScriptParser::ArrayNode *>(p_for->list);
+	GDScriptCodeGenerator *gen = codegen.generator;
+
+	// Evaluate all the elements before the loop, in order, as the array construction would.
+	Vector<GDScriptCodeGenerator::Address> items;
+	for (int i = 0; i < an->elements.size(); i++) {
+		GDScriptCodeGenerator::Address item(GDScriptCodeGenerator::Address::LOCAL_VARIABLE, gen->add_local("@item_" + itos(i), GDScriptDataType()));
+
+		Error err = OK;
+		GDScriptCodeGenerator::Address value = _parse_expression(codegen, err, an->elements[i]);
+		if (err) {
+			return err;
+		}
+		gen->write_assign(item, value);
+		if (value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+			gen->pop_temporary();
+		}
+		items.push_back(item);
+	}
+
+	GDScriptDataType int_type;
+	int_type.has_type = true;
+	int_type.kind = GDScriptDataType::BUILTIN;
+	int_type.builtin_type = Variant::INT;
+	GDScriptCodeGenerator::Address index(GDScriptCodeGenerator::Address::LOCAL_VARIABLE, gen->add_local("@item_index", int_type), int_type);
+
+	gen->start_for(int_type, int_type);
+	gen->write_for_assignment(codegen.add_constant(items.size()));
+	gen->write_for(index, false);
+
+	// Select the element of the current iteration.
+	GDScriptDataType bool_type;
+	bool_type.has_type = true;
+	bool_type.kind = GDScriptDataType::BUILTIN;
+	bool_type.builtin_type = Variant::BOOL;
+	GDScriptCodeGenerator::Address is_current = codegen.add_temporary(bool_type);
+	for (int i = 0; i < items.size(); i++) {
+		if (i < items.size() - 1) {
+			gen->write_binary_operator(is_current, Variant::OP_EQUAL, index, codegen.add_constant(i));
+			gen->write_if(is_current);
+		}
+		if (p_for->use_conversion_assign) {
+			gen->write_assign_with_conversion(p_variable, items[i]);
+		} else {
+			gen->write_assign(p_variable, items[i]);
+		}
+		if (i < items.size() - 1) {
+			gen->write_else();
+		}
+	}
+	for (int i = 0; i < items.size() - 1; i++) {
+		gen->write_endif();
+	}
+	gen->pop_temporary();
+
+	Error err = _parse_block(codegen, p_for->loop);
+	if (err) {
+		return err;
+	}
+
+	gen->write_endfor();
+
+	for (const GDScriptCodeGenerator::Address &item : items) {
+		gen->write_assign_false(item); // Can contain RefCounted, so clear it.
+	}
+
+	return OK;
+}
+
 Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block, bool p_add_locals, bool p_reset_locals) {
 	Error err = OK;
 	GDScriptCodeGenerator *gen = codegen.generator;
@@ -2008,6 +2137,15 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 				codegen.start_block();
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
+				if (_can_iterate_array_literal_in_place(for_n->list)) {
+					err = _parse_for_array_literal(codegen, for_n, iterator);
+					if (err) {
+						return err;
+					}
+					codegen.end_block();
+					break;
+				}
+
 				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
 
 				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
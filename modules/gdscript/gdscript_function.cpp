@@ -32,6 +32,9 @@
 
 #include "gdscript.h"
 
+#include "core/core_string_names.h"
+#include "core/object/class_db.h"
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -42,6 +45,55 @@ StringName GDScriptFunction::get_global_name(int p_idx) const {
 	return global_names[p_idx];
 }
 
+const GDScriptFunction::MemberCache::Entry *GDScriptFunction::_add_member_cache_entry(MemberCache &p_cache, MemberCacheType p_type, const StringName &p_class_name, const StringName &p_member) {
+	static Mutex cache_mutex;
+	MutexLock lock(cache_mutex);
+
+	// Check again in case another thread already added it.
+	uint32_t count = p_cache.entry_count.get();
+	for (uint32_t i = 0; i < count; i++) {
+		if (p_cache.entries[i].class_name == p_class_name) {
+			return p_cache.entries[i].method ? &p_cache.entries[i] : nullptr;
+		}
+	}
+	if (count == MemberCache::MAX_ENTRIES) {
+		return nullptr;
+	}
+
+	MemberCache::Entry &entry = p_cache.entries[count];
+	entry.class_name = p_class_name;
+	entry.method = nullptr;
+	entry.index = -1;
+
+	ClassDB::APIType api = ClassDB::get_api_type(p_class_name);
+	bool is_extension = api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION;
+
+	switch (p_type) {
+		case MEMBER_CACHE_GET:
+		case MEMBER_CACHE_SET: {
+			// Extensions can override `get()` and `set()`. Names that also match a method, constant or signal
+			// may be resolved to those by `ClassDB::get_property()`, so leave them to the slow path too.
+			if (is_extension || ClassDB::has_method(p_class_name, p_member) || ClassDB::has_integer_constant(p_class_name, p_member) || ClassDB::has_signal(p_class_name, p_member)) {
+				break;
+			}
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(p_class_name, p_member);
+			if (psg) {
+				entry.method = p_type == MEMBER_CACHE_GET ? psg->_getptr : psg->_setptr;
+				entry.index = psg->index;
+			}
+		} break;
+		case MEMBER_CACHE_CALL: {
+			if (p_member != CoreStringNames::get_singleton()->_free) {
+				entry.method = ClassDB::get_method(p_class_name, p_member);
+			}
+		} break;
+	}
+
+	// Publish the entry only once it's fully written.
+	p_cache.entry_count.increment();
+	return entry.method ? &entry : nullptr;
+}
+
 struct _GDFKC {
 	int order = 0;
 	List<int> pos;
@@ -121,6 +173,10 @@ GDScriptFunction::~GDScriptFunction() {
 		memdelete(lambdas[i]);
 	}
 
+	if (_member_caches) {
+		memdelete_arr(_member_caches);
+	}
+
 	for (int i = 0; i < argument_types.size(); i++) {
 		argument_types.write[i].script_type_ref = Ref<Script>();
 	}
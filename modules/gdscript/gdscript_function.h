@@ -199,6 +199,31 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_EQUAL_INT,
+		OPCODE_OPERATOR_NOT_EQUAL_INT,
+		OPCODE_OPERATOR_LESS_INT,
+		OPCODE_OPERATOR_LESS_EQUAL_INT,
+		OPCODE_OPERATOR_GREATER_INT,
+		OPCODE_OPERATOR_GREATER_EQUAL_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_OPERATOR_EQUAL_FLOAT,
+		OPCODE_OPERATOR_NOT_EQUAL_FLOAT,
+		OPCODE_OPERATOR_LESS_FLOAT,
+		OPCODE_OPERATOR_LESS_EQUAL_FLOAT,
+		OPCODE_OPERATOR_GREATER_FLOAT,
+		OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,
+		OPCODE_OPERATOR_ADD_VECTOR2,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR2,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR2_FLOAT,
+		OPCODE_OPERATOR_ADD_VECTOR3,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR3,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_NATIVE,
@@ -375,6 +400,7 @@ public:
 private:
 	friend class GDScript;
 	friend class GDScriptCompiler;
+	friend class GDScriptByteCodeCache;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
 
@@ -451,6 +477,53 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	// Inline cache of a named access or call on an untyped value, keyed by the class of the receiver.
+	// Entries are only appended (under a lock) and never modified afterwards, so they can be read without locking.
+	struct MemberCache {
+		static constexpr uint32_t MAX_ENTRIES = 4;
+
+		struct Entry {
+			StringName class_name;
+			MethodBind *method = nullptr; // `nullptr` if the member must be resolved by name for this class.
+			int index = -1; // Index argument of indexed properties.
+		};
+
+		Entry entries[MAX_ENTRIES];
+		SafeNumeric<uint32_t> entry_count;
+	};
+
+	enum MemberCacheType {
+		MEMBER_CACHE_GET,
+		MEMBER_CACHE_SET,
+		MEMBER_CACHE_CALL,
+	};
+
+	MemberCache *_member_caches = nullptr;
+	int _member_caches_count = 0;
+
+	const MemberCache::Entry *_add_member_cache_entry(MemberCache &p_cache, MemberCacheType p_type, const StringName &p_class_name, const StringName &p_member);
+	_FORCE_INLINE_ const MemberCache::Entry *_get_member_cache_entry(int p_cache, MemberCacheType p_type, const Object *p_object, const StringName &p_member) {
+		if (p_object->get_script_instance()) {
+			// Scripts can override members, always resolve them by name.
+			return nullptr;
+		}
+
+		MemberCache &cache = _member_caches[p_cache];
+		const StringName &class_name = p_object->get_class_name();
+		uint32_t count = cache.entry_count.get();
+		for (uint32_t i = 0; i < count; i++) {
+			if (cache.entries[i].class_name == class_name) {
+				return cache.entries[i].method ? &cache.entries[i] : nullptr;
+			}
+		}
+
+		if (count == MemberCache::MAX_ENTRIES) {
+			// Megamorphic, don't look it up again.
+			return nullptr;
+		}
+		return _add_member_cache_entry(cache, p_type, class_name, p_member);
+	}
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
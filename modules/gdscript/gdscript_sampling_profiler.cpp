@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "gdscript_function.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+
+SafeFlag GDScriptSamplingProfiler::running;
+SafeNumeric<uint64_t> GDScriptSamplingProfiler::ticks;
+thread_local GDScriptSamplingProfiler::Frame *GDScriptSamplingProfiler::current_frame = nullptr;
+thread_local uint64_t GDScriptSamplingProfiler::thread_ticks = 0;
+
+Thread *GDScriptSamplingProfiler::thread = nullptr;
+SafeFlag GDScriptSamplingProfiler::exit_thread;
+uint64_t GDScriptSamplingProfiler::interval_usec = 1000;
+
+Mutex GDScriptSamplingProfiler::mutex;
+HashMap<String, uint64_t> GDScriptSamplingProfiler::stacks;
+
+String GDScriptSamplingProfiler::command_line_path;
+int GDScriptSamplingProfiler::command_line_interval_usec = 1000;
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	Thread::set_name("GDScript Sampling Profiler");
+	while (!exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(interval_usec);
+		ticks.increment();
+	}
+}
+
+void GDScriptSamplingProfiler::_push_frame(Frame *p_frame, const GDScriptFunction *p_function, const int *p_line) {
+	if (current_frame) {
+		// Time since the last sample was spent on the caller's line, possibly in native code calling back into scripts.
+		sample();
+	} else {
+		// Entering script code from the engine, ticks observed until now were spent outside of it.
+		thread_ticks = ticks.get();
+	}
+
+	p_frame->function = p_function;
+	p_frame->line = p_line;
+	p_frame->parent = current_frame;
+	current_frame = p_frame;
+}
+
+void GDScriptSamplingProfiler::_pop_frame(Frame *p_frame) {
+	sample();
+	current_frame = p_frame->parent;
+}
+
+void GDScriptSamplingProfiler::_record(const String &p_native_frame) {
+	static constexpr uint32_t MAX_DEPTH = 256;
+
+	uint64_t now = ticks.get();
+	uint64_t count = now - thread_ticks;
+	thread_ticks = now;
+
+	LocalVector<String> frames;
+	for (const Frame *frame = current_frame; frame && frames.size() < MAX_DEPTH; frame = frame->parent) {
+		frames.push_back(vformat("%s (%s:%d)", frame->function->get_name(), frame->function->get_source(), *frame->line));
+	}
+
+	// Collapsed stacks go from the outermost frame to the innermost one.
+	String stack;
+	for (int i = frames.size() - 1; i >= 0; i--) {
+		stack += frames[i];
+		if (i > 0) {
+			stack += ";";
+		}
+	}
+	if (!p_native_frame.is_empty()) {
+		stack += ";" + p_native_frame;
+	}
+
+	MutexLock lock(mutex);
+	stacks[stack] += count;
+}
+
+void GDScriptSamplingProfiler::start(uint64_t p_interval_usec) {
+	ERR_FAIL_COND_MSG(running.is_set(), "The GDScript sampling profiler is already running.");
+
+	interval_usec = MAX(p_interval_usec, 1u);
+	exit_thread.clear();
+	running.set();
+
+	thread = memnew(Thread);
+	thread->start(_thread_func, nullptr);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!running.is_set()) {
+		return;
+	}
+
+	running.clear();
+	exit_thread.set();
+	thread->wait_to_finish();
+	memdelete(thread);
+	thread = nullptr;
+}
+
+void GDScriptSamplingProfiler::clear() {
+	MutexLock lock(mutex);
+	stacks.clear();
+}
+
+String GDScriptSamplingProfiler::get_collapsed_stacks() {
+	MutexLock lock(mutex);
+
+	LocalVector<String> keys;
+	keys.reserve(stacks.size());
+	for (const KeyValue<String, uint64_t> &E : stacks) {
+		keys.push_back(E.key);
+	}
+	keys.sort();
+
+	String result;
+	for (const String &key : keys) {
+		result += key + " " + itos(stacks[key]) + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save(const String &p_path) {
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, vformat(R"(Cannot open file "%s" to save the GDScript sampling profile.)", p_path));
+
+	file->store_string(get_collapsed_stacks());
+	return OK;
+}
+
+#endif // DEBUG_ENABLED
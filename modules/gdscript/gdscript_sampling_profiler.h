@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#ifdef DEBUG_ENABLED
+
+#include "core/object/method_bind.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+
+// Statistical profiler for GDScript. A background thread advances a tick counter at a fixed interval, and each
+// thread running GDScript attributes the ticks it observes to its own call stack when the current line changes
+// and after native calls. Unlike the instrumenting profiler, it only costs a flag check while not running.
+// Stacks are exported in the collapsed format read by flame graph tools (`frame;frame;frame count` per line).
+class GDScriptSamplingProfiler {
+public:
+	struct Frame {
+		const GDScriptFunction *function = nullptr;
+		const int *line = nullptr;
+		Frame *parent = nullptr;
+	};
+
+	// Adds a frame to the calling thread's stack for the duration of a function call, if the profiler is running.
+	class FrameScope {
+		Frame frame;
+		bool pushed = false;
+
+	public:
+		_FORCE_INLINE_ FrameScope(const GDScriptFunction *p_function, const int *p_line) {
+			if (unlikely(running.is_set())) {
+				_push_frame(&frame, p_function, p_line);
+				pushed = true;
+			}
+		}
+		_FORCE_INLINE_ ~FrameScope() {
+			if (unlikely(pushed)) {
+				_pop_frame(&frame);
+			}
+		}
+	};
+
+private:
+	static SafeFlag running;
+	static SafeNumeric<uint64_t> ticks;
+	static thread_local Frame *current_frame;
+	static thread_local uint64_t thread_ticks;
+
+	static Thread *thread;
+	static SafeFlag exit_thread;
+	static uint64_t interval_usec;
+
+	static Mutex mutex;
+	static HashMap<String, uint64_t> stacks;
+
+	static void _thread_func(void *p_userdata);
+	static void _push_frame(Frame *p_frame, const GDScriptFunction *p_function, const int *p_line);
+	static void _pop_frame(Frame *p_frame);
+	static void _record(const String &p_native_frame);
+
+	_FORCE_INLINE_ static bool _has_pending_ticks() {
+		return unlikely(running.is_set()) && current_frame && ticks.get() != thread_ticks;
+	}
+
+public:
+	// Set from the command line, the profiler runs for the whole session and is saved here on exit.
+	static String command_line_path;
+	static int command_line_interval_usec;
+
+	// Attributes the ticks since the last sample to the current line.
+	_FORCE_INLINE_ static void sample() {
+		if (_has_pending_ticks()) {
+			_record(String());
+		}
+	}
+
+	// Attributes the ticks since the last sample to a native call made from the current line.
+	_FORCE_INLINE_ static void sample_native(const MethodBind *p_method) {
+		if (_has_pending_ticks()) {
+			_record(String(p_method->get_instance_class()) + "." + String(p_method->get_name()));
+		}
+	}
+	_FORCE_INLINE_ static void sample_native(const StringName &p_class, const StringName &p_method) {
+		if (_has_pending_ticks()) {
+			_record(String(p_class) + "." + String(p_method));
+		}
+	}
+
+	static void start(uint64_t p_interval_usec = 1000);
+	static void stop();
+	static bool is_running() { return running.is_set(); }
+
+	static void clear();
+	static String get_collapsed_stacks();
+	static Error save(const String &p_path);
+};
+
+#endif // DEBUG_ENABLED
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
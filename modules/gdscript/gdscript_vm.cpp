@@ -31,10 +31,23 @@
 #include "gdscript.h"
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
+#include "gdscript_sampling_profiler.h"
 
+#include "core/config/engine.h"
 #include "core/core_string_names.h"
 #include "core/os/os.h"
 
+#include <atomic>
+
+// C++17 has no std::atomic_ref, so bytecode slots shared between threads are accessed through std::atomic,
+// which has the size and representation of a plain int on every supported platform.
+static_assert(sizeof(std::atomic<int>) == sizeof(int) && alignof(std::atomic<int>) == alignof(int), "std::atomic<int> must be layout-compatible with int.");
+static_assert(std::atomic<int>::is_always_lock_free, "std::atomic<int> must be lock-free.");
+
+static _FORCE_INLINE_ std::atomic<int> &_get_atomic_code_slot(int *p_slot) {
+	return *reinterpret_cast<std::atomic<int> *>(p_slot);
+}
+
 #ifdef DEBUG_ENABLED
 
 static bool _profile_count_as_native(const Object *p_base_obj, const StringName &p_methodname) {
@@ -98,6 +111,8 @@ static String _get_var_type(const Variant *p_var) {
 }
 
 void GDScriptFunction::_profile_native_call(uint64_t p_t_taken, const String &p_func_name, const String &p_instance_class_name) {
+	// The function may run on several threads at once.
+	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 	HashMap<String, Profile::NativeProfile>::Iterator inner_prof = profile.native_calls.find(p_func_name);
 	if (inner_prof) {
 		inner_prof->value.call_count += 1;
@@ -215,6 +230,31 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {          \
 		&&OPCODE_OPERATOR,                             \
 		&&OPCODE_OPERATOR_VALIDATED,                   \
+		&&OPCODE_OPERATOR_ADD_INT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                \
+		&&OPCODE_OPERATOR_EQUAL_INT,                   \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,               \
+		&&OPCODE_OPERATOR_LESS_INT,                    \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,              \
+		&&OPCODE_OPERATOR_GREATER_INT,                 \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,           \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,              \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,              \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,                \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,                 \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,             \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                  \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,            \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,               \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,         \
+		&&OPCODE_OPERATOR_ADD_VECTOR2,                 \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR2,            \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR2_FLOAT,      \
+		&&OPCODE_OPERATOR_ADD_VECTOR3,                 \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR3,            \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3_FLOAT,      \
 		&&OPCODE_TYPE_TEST_BUILTIN,                    \
 		&&OPCODE_TYPE_TEST_ARRAY,                      \
 		&&OPCODE_TYPE_TEST_NATIVE,                     \
@@ -489,6 +529,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	GDScript *script;
 	int ip = 0;
 	int line = _initial_line;
+	bool frame_moved = false;
 
 	if (p_state) {
 		//use existing (supplied) state (awaited)
@@ -583,6 +624,8 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		GDScriptLanguage::get_singleton()->enter_function(p_instance, this, stack, &ip, &line);
 	}
 
+	GDScriptSamplingProfiler::FrameScope sampling_frame(this, &line);
+
 #define GD_ERR_BREAK(m_cond)                                                                                           \
 	{                                                                                                                  \
 		if (unlikely(m_cond)) {                                                                                        \
@@ -680,14 +723,16 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GET_VARIANT_PTR(b, 1);
 				GET_VARIANT_PTR(dst, 2);
 				// Compute signatures (types of operands) so it can be optimized when matching.
-				uint32_t op_signature = _code_ptr[ip + 5];
+				// The acquire pairs with the release below: once the signature is seen, so are the return type and evaluator.
+				std::atomic<int> &signature_slot = _get_atomic_code_slot(&_code_ptr[ip + 5]);
+				uint32_t op_signature = signature_slot.load(std::memory_order_acquire);
 				uint32_t actual_signature = (a->get_type() << 8) | (b->get_type());
 
 #ifdef DEBUG_ENABLED
 				if (op == Variant::OP_DIVIDE || op == Variant::OP_MODULE) {
 					// Don't optimize division and modulo since there's not check for division by zero with validated calls.
 					op_signature = 0xFFFF;
-					_code_ptr[ip + 5] = op_signature;
+					signature_slot.store(op_signature, std::memory_order_relaxed);
 				}
 #endif
 
@@ -712,11 +757,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						op_func(a, b, dst);
 
 						// Check again in case another thread already set it.
-						if (_code_ptr[ip + 5] == 0) {
-							_code_ptr[ip + 5] = actual_signature;
+						if (signature_slot.load(std::memory_order_relaxed) == 0) {
 							_code_ptr[ip + 6] = static_cast<int>(ret_type);
 							Variant::ValidatedOperatorEvaluator *tmp = reinterpret_cast<Variant::ValidatedOperatorEvaluator *>(&_code_ptr[ip + 7]);
 							*tmp = op_func;
+							// Publish the signature last, so other threads running this code never see it without the evaluator.
+							signature_slot.store(actual_signature, std::memory_order_release);
 						}
 					}
 					initializer_mutex.unlock();
@@ -772,6 +818,43 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_name, m_left_get_func, m_right_get_func, m_ret_get_func, m_op)                                   \
+	OPCODE(OPCODE_OPERATOR_##m_name) {                                                                                           \
+		CHECK_SPACE(4);                                                                                                          \
+		GET_VARIANT_PTR(a, 0);                                                                                                   \
+		GET_VARIANT_PTR(b, 1);                                                                                                   \
+		GET_VARIANT_PTR(dst, 2);                                                                                                 \
+		*VariantInternal::m_ret_get_func(dst) = *VariantInternal::m_left_get_func(a) m_op *VariantInternal::m_right_get_func(b); \
+		ip += 4;                                                                                                                 \
+	}                                                                                                                            \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(ADD_INT, get_int, get_int, get_int, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_INT, get_int, get_int, get_int, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_INT, get_int, get_int, get_int, *);
+			OPCODE_OPERATOR_TYPED(EQUAL_INT, get_int, get_int, get_bool, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL_INT, get_int, get_int, get_bool, !=);
+			OPCODE_OPERATOR_TYPED(LESS_INT, get_int, get_int, get_bool, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL_INT, get_int, get_int, get_bool, <=);
+			OPCODE_OPERATOR_TYPED(GREATER_INT, get_int, get_int, get_bool, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL_INT, get_int, get_int, get_bool, >=);
+			OPCODE_OPERATOR_TYPED(ADD_FLOAT, get_float, get_float, get_float, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_FLOAT, get_float, get_float, get_float, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_FLOAT, get_float, get_float, get_float, *);
+			OPCODE_OPERATOR_TYPED(DIVIDE_FLOAT, get_float, get_float, get_float, /);
+			OPCODE_OPERATOR_TYPED(EQUAL_FLOAT, get_float, get_float, get_bool, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL_FLOAT, get_float, get_float, get_bool, !=);
+			OPCODE_OPERATOR_TYPED(LESS_FLOAT, get_float, get_float, get_bool, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL_FLOAT, get_float, get_float, get_bool, <=);
+			OPCODE_OPERATOR_TYPED(GREATER_FLOAT, get_float, get_float, get_bool, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL_FLOAT, get_float, get_float, get_bool, >=);
+			OPCODE_OPERATOR_TYPED(ADD_VECTOR2, get_vector2, get_vector2, get_vector2, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_VECTOR2, get_vector2, get_vector2, get_vector2, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_VECTOR2_FLOAT, get_vector2, get_float, get_vector2, *);
+			OPCODE_OPERATOR_TYPED(ADD_VECTOR3, get_vector3, get_vector3, get_vector3, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT_VECTOR3, get_vector3, get_vector3, get_vector3, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY_VECTOR3_FLOAT, get_vector3, get_float, get_vector3, *);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1074,7 +1157,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1084,12 +1167,35 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _member_caches_count);
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				bool use_cache = true;
+#ifdef TOOLS_ENABLED
+				// Not in the editor, where `Object::set()` also marks the object as edited.
+				use_cache = !Engine::get_singleton()->is_editor_hint();
+#endif
+				Object *obj = use_cache ? dst->get_validated_object() : nullptr;
+				const MemberCache::Entry *cached = obj ? _get_member_cache_entry(cache_index, MEMBER_CACHE_SET, obj, *index) : nullptr;
+				if (cached) {
+					Callable::CallError ce;
+					if (cached->index >= 0) {
+						Variant property_index = cached->index;
+						const Variant *args[2] = { &property_index, value };
+						cached->method->call(obj, args, 2, ce);
+					} else {
+						const Variant *args[1] = { value };
+						cached->method->call(obj, args, 1, ce);
+					}
+					valid = ce.error == Callable::CallError::CALL_OK;
+				} else {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
-					Object *obj = dst->get_validated_object();
+					obj = dst->get_validated_object();
 					bool read_only_property = false;
 					if (obj) {
 						read_only_property = ClassDB::has_property(obj->get_class_name(), *index) && (ClassDB::get_property_setter(obj->get_class_name(), *index) == StringName());
@@ -1102,7 +1208,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1122,7 +1228,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1132,22 +1238,38 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
+				int cache_index = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _member_caches_count);
+
+				Object *obj = src->get_validated_object();
+				const MemberCache::Entry *cached = obj ? _get_member_cache_entry(cache_index, MEMBER_CACHE_GET, obj, *index) : nullptr;
+				if (cached) {
+					Callable::CallError ce;
+					if (cached->index >= 0) {
+						Variant property_index = cached->index;
+						const Variant *args[1] = { &property_index };
+						*dst = cached->method->call(obj, args, 1, ce);
+					} else {
+						*dst = cached->method->call(obj, nullptr, 0, ce);
+					}
+				} else {
+					bool valid;
 #ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+					//allow better error message in cases where src and dst are the same stack position
+					Variant ret = src->get_named(*index, valid);
 
 #else
-				*dst = src->get_named(*index, valid);
+					*dst = src->get_named(*index, valid);
 #endif
 #ifdef DEBUG_ENABLED
-				if (!valid) {
-					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
-					OPCODE_BREAK;
-				}
-				*dst = ret;
+					if (!valid) {
+						err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
+						OPCODE_BREAK;
+					}
+					*dst = ret;
 #endif
-				ip += 4;
+				}
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1673,7 +1795,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1684,9 +1806,15 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_index = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_index < 0 || cache_index >= _member_caches_count);
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
+				Object *base_obj = base->get_validated_object();
+				const MemberCache::Entry *cached = base_obj ? _get_member_cache_entry(cache_index, MEMBER_CACHE_CALL, base_obj, *methodname) : nullptr;
+
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
 
@@ -1694,14 +1822,22 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					call_time = OS::get_singleton()->get_ticks_usec();
 				}
 				Variant::Type base_type = base->get_type();
-				Object *base_obj = base->get_validated_object();
 				StringName base_class = base_obj ? base_obj->get_class_name() : StringName();
+				GDScriptSamplingProfiler::sample();
 #endif
 
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (cached) {
+#ifdef DEBUG_ENABLED
+						// Lock the object as `Object::callp()` does, so the method can't free it.
+						_ObjectDebugLock debug_lock(base_obj);
+#endif
+						*ret = cached->method->call(base_obj, (const Variant **)argptrs, argc, err);
+					} else {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1729,11 +1865,21 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 #endif
+				} else if (cached) {
+#ifdef DEBUG_ENABLED
+					_ObjectDebugLock debug_lock(base_obj);
+#endif
+					cached->method->call(base_obj, (const Variant **)argptrs, argc, err);
 				} else {
 					Variant ret;
 					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
 				}
 #ifdef DEBUG_ENABLED
+				if (base_obj) {
+					GDScriptSamplingProfiler::sample_native(base_class, *methodname);
+				} else {
+					GDScriptSamplingProfiler::sample();
+				}
 
 				if (GDScriptLanguage::get_singleton()->profiling) {
 					uint64_t t_taken = OS::get_singleton()->get_ticks_usec() - call_time;
@@ -1781,7 +1927,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -1820,6 +1966,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
 					call_time = OS::get_singleton()->get_ticks_usec();
 				}
+				GDScriptSamplingProfiler::sample();
 #endif
 
 				Callable::CallError err;
@@ -1831,6 +1978,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 
 #ifdef DEBUG_ENABLED
+				GDScriptSamplingProfiler::sample_native(method);
 
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
 					uint64_t t_taken = OS::get_singleton()->get_ticks_usec() - call_time;
@@ -1980,12 +2128,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
 					call_time = OS::get_singleton()->get_ticks_usec();
 				}
+				GDScriptSamplingProfiler::sample();
 #endif
 
 				GET_INSTRUCTION_ARG(ret, argc + 1);
 				method->validated_call(base_obj, (const Variant **)argptrs, ret);
 
 #ifdef DEBUG_ENABLED
+				GDScriptSamplingProfiler::sample_native(method);
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
 					uint64_t t_taken = OS::get_singleton()->get_ticks_usec() - call_time;
 					_profile_native_call(t_taken, method->get_name(), method->get_instance_class());
@@ -2029,6 +2179,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
 					call_time = OS::get_singleton()->get_ticks_usec();
 				}
+				GDScriptSamplingProfiler::sample();
 #endif
 
 				GET_INSTRUCTION_ARG(ret, argc + 1);
@@ -2036,6 +2187,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				method->validated_call(base_obj, (const Variant **)argptrs, nullptr);
 
 #ifdef DEBUG_ENABLED
+				GDScriptSamplingProfiler::sample_native(method);
 				if (GDScriptLanguage::get_singleton()->profiling && GDScriptLanguage::get_singleton()->profile_native_calls) {
 					uint64_t t_taken = OS::get_singleton()->get_ticks_usec() - call_time;
 					_profile_native_call(t_taken, method->get_name(), method->get_instance_class());
@@ -2273,14 +2425,6 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
-					}
-					gdfs->state.stack_size = _stack_size;
-					gdfs->state.alloca_size = alloca_size;
 					gdfs->state.ip = ip + 2;
 					gdfs->state.line = line;
 					gdfs->state.script = _script;
@@ -2305,10 +2449,27 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 					Error err = sig.connect(Callable(gdfs.ptr(), "_signal_callback").bind(retvalue), Object::CONNECT_ONE_SHOT);
 					if (err != OK) {
+						// The frame is still owned by this call (or the state it was resumed from), so it is freed as usual.
 						err_text = "Error connecting to signal: " + sig.get_name() + " during await.";
 						OPCODE_BREAK;
 					}
 
+					// This call ends here, so the frame is moved to the state instead of being copied.
+					// Only done once connected, as `stack` then points into the buffer owned by `gdfs`.
+					if (p_state) {
+						// Resumed from a previous await, the frame already lives in that state: hand it over.
+						gdfs->state.stack = p_state->stack;
+						p_state->stack = Vector<uint8_t>();
+						p_state->stack_size = 0;
+					} else {
+						gdfs->state.stack.resize(alloca_size);
+						// First 3 stack addresses are special, so we just skip them here.
+						memcpy((void *)&gdfs->state.stack.ptrw()[sizeof(Variant) * FIXED_ADDRESSES_MAX], (const void *)&stack[FIXED_ADDRESSES_MAX], sizeof(Variant) * (_stack_size - FIXED_ADDRESSES_MAX));
+					}
+					frame_moved = true;
+					gdfs->state.stack_size = _stack_size;
+					gdfs->state.alloca_size = alloca_size;
+
 #ifdef DEBUG_ENABLED
 					exit_ok = true;
 					awaited = true;
@@ -3459,6 +3620,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			OPCODE(OPCODE_LINE) {
 				CHECK_SPACE(2);
 
+#ifdef DEBUG_ENABLED
+				// Ticks observed here were spent on the previous line.
+				GDScriptSamplingProfiler::sample();
+#endif
+
 				line = _code_ptr[ip + 1];
 				ip += 2;
 
@@ -3564,9 +3730,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		}
 #endif
 
-		// Free stack, except reserved addresses.
-		for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-			stack[i].~Variant();
+		// Free stack, except reserved addresses, unless it was moved to a function state by `await`.
+		if (!frame_moved) {
+			for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
 		}
 #ifdef DEBUG_ENABLED
 	}
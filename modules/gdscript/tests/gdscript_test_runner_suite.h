@@ -32,6 +32,7 @@
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
 #include "gdscript_test_runner.h"
+#include "gdscript_test_utils.h"
 
 #include "tests/test_macros.h"
 
@@ -51,19 +52,12 @@ TEST_SUITE("[Modules][GDScript]") {
 }
 
 TEST_CASE("[Modules][GDScript] Load source code dynamically and run it") {
-	Ref<GDScript> gdscript = memnew(GDScript);
-	gdscript->set_source_code(R"(
+	Ref<GDScript> gdscript = compile_test_script(R"(
 extends RefCounted
 
 func _init():
 	set_meta("result", 42)
 )");
-	// A spurious `Condition "err" is true` message is printed (despite parsing being successful and returning `OK`).
-	// Silence it.
-	ERR_PRINT_OFF;
-	const Error error = gdscript->reload();
-	ERR_PRINT_ON;
-	CHECK_MESSAGE(error == OK, "The script should parse successfully.");
 
 	// Run the script by assigning it to a reference-counted object.
 	Ref<RefCounted> ref_counted = memnew(RefCounted);
@@ -0,0 +1,67 @@
+/**************************************************************************/
+/*  gdscript_test_utils.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_TEST_UTILS_H
+#define GDSCRIPT_TEST_UTILS_H
+
+#include "../gdscript.h"
+
+#include "core/io/resource_loader.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+// Compiling a script outside of the test runner prints a spurious `Condition "err" is true` message
+// (despite parsing being successful and returning `OK`), so both helpers silence errors while doing it.
+
+// Compiles a script from its source code.
+static Ref<GDScript> compile_test_script(const String &p_source) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_source);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The test script should parse successfully.");
+	return gdscript;
+}
+
+// Loads and compiles a script file, bypassing the resource cache.
+static Ref<GDScript> load_test_script(const String &p_path) {
+	ERR_PRINT_OFF;
+	Ref<GDScript> gdscript = ResourceLoader::load(p_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(gdscript.is_valid(), "The test script should load successfully.");
+	return gdscript;
+}
+
+} // namespace GDScriptTests
+
+#endif // GDSCRIPT_TEST_UTILS_H
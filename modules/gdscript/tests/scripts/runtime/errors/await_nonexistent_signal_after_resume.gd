@@ -0,0 +1,12 @@
+signal step
+
+func wait_twice():
+	var held := RefCounted.new()
+	await step
+	await Signal(self, "missing")
+	print(held)
+
+func test():
+	wait_twice()
+	step.emit()
+	print("not ok")
@@ -0,0 +1,50 @@
+var calls := 0
+
+func next_value(value):
+	calls += 1
+	return value
+
+func test():
+	var a := 1
+	var b := "two"
+	var c := Vector2(3, 4)
+
+	print("Elements are evaluated once, in order.")
+	for e in [next_value(a), next_value(b), next_value(c)]:
+		prints(calls, var_to_str(e))
+
+	print("Break and continue.")
+	for e in [a, a + 1, a + 2, a + 3]:
+		if e == 2:
+			continue
+		if e == 4:
+			break
+		print(e)
+
+	print("Nested loops.")
+	for x in [a, a + 1]:
+		for y in [b, b + "!"]:
+			prints(x, y)
+
+	print("Typed iterator.")
+	for e: float in [a, a + 1]:
+		print(var_to_str(e))
+
+	print("Modifying the iterated values.")
+	var arr := [a]
+	for e in [arr, a]:
+		if e is Array:
+			e.push_back(2)
+	print(arr)
+
+	print("More elements than iterated in place.")
+	var sum := 0
+	for e in [a, a, a, a, a, a, a, a, a, a]:
+		sum += e
+	print(sum)
+
+	print("References are released after the loop.")
+	var ref := RefCounted.new()
+	for _e in [ref, a]:
+		pass
+	print(ref.get_reference_count())
@@ -0,0 +1,21 @@
+signal step
+
+var ref := RefCounted.new()
+
+func counter(label: String):
+	var count := 0
+	var held := ref
+	while count < 3:
+		var value = await step
+		count += 1
+		prints(label, count, value, held == ref)
+	return count
+
+func test():
+	counter("a")
+	counter("b")
+	print(ref.get_reference_count())
+	step.emit(1)
+	step.emit(2)
+	step.emit(3)
+	print(ref.get_reference_count())
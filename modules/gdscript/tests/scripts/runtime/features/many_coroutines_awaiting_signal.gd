@@ -0,0 +1,26 @@
+# Many long-lived coroutines waiting for a signal every frame, like per-agent AI logic.
+signal tick
+
+var running := true
+var resumed := 0
+
+func agent(index: int) -> void:
+	var position := Vector3()
+	var velocity := Vector3(index, 0, 1)
+	while running:
+		await tick
+		position += velocity
+		resumed += 1
+
+func test():
+	const AGENTS = 1000
+	const FRAMES = 10
+	for i in AGENTS:
+		agent(i)
+	for _i in FRAMES:
+		tick.emit()
+	print(resumed == AGENTS * FRAMES)
+	running = false
+	tick.emit()
+	print(resumed == AGENTS * (FRAMES + 1))
+	print(tick.get_connections().size())
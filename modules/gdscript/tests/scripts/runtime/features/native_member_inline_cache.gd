@@ -0,0 +1,56 @@
+class Shifted extends Node2D:
+	func _get(property):
+		if property == &"position":
+			return Vector2(-1, -1)
+		return null
+
+
+func read_position(object):
+	return object.position
+
+
+func write_rotation(object, value):
+	object.rotation = value
+
+
+func read_limit(object):
+	return object.limit_left
+
+
+func write_limit(object, value):
+	object.limit_left = value
+
+
+func call_get_class(object):
+	return object.get_class()
+
+
+func test():
+	# Same instructions with receivers of different classes, including one whose script overrides a property.
+	var nodes = [Node2D.new(), Sprite2D.new(), Shifted.new(), Node2D.new()]
+	for i in nodes.size():
+		nodes[i].position = Vector2(i, i * 2)
+		write_rotation(nodes[i], 0.5)
+		print(read_position(nodes[i]), " ", nodes[i].rotation, " ", call_get_class(nodes[i]))
+
+	# Indexed property.
+	var camera = Camera2D.new()
+	camera.limit_left = 5
+	print(read_limit(camera))
+	for i in 2:
+		write_limit(camera, 7 + i)
+		print(camera.limit_left)
+	nodes.push_back(camera)
+
+	# More classes than the cache holds.
+	var objects = [Node.new(), Node3D.new(), Control.new(), Timer.new(), RefCounted.new()]
+	for object in objects:
+		print(call_get_class(object))
+
+	# Non-object receivers.
+	print(read_position({ position = "dictionary" }))
+
+	for node in nodes:
+		node.free()
+	for i in 4:
+		objects[i].free()
@@ -0,0 +1,34 @@
+func test():
+	var i := 10
+	i += 5
+	i -= 3
+	i *= 2
+	i %= 5
+	print(i)
+
+	var f := 1.5
+	f += 1
+	f *= 2.0
+	f -= 0.5
+	f /= 2
+	print(f)
+
+	var v := Vector3(1, 2, 3)
+	v += Vector3(1, 1, 1)
+	v *= 2.0
+	v -= Vector3.ONE
+	print(v)
+
+	var c := Color(0.5, 0.5, 0.5, 1)
+	c *= 2.0
+	print(c)
+
+	var g: float = 1.0
+	g += 2
+	print(g)
+
+	# The value type is only known at runtime here.
+	var total := 0
+	for value in [1, 2, 3]:
+		total += value
+	print(total)
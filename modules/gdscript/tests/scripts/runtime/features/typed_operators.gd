@@ -0,0 +1,36 @@
+func test():
+	var a: int = 7
+	var b: int = 3
+	print(a + b)
+	print(a - b)
+	print(a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+
+	var x: float = 2.5
+	var y: float = 0.5
+	print(x + y)
+	print(x - y)
+	print(x * y)
+	print(x / y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+
+	var u := Vector2(1, 2)
+	var v := Vector2(3, 5)
+	print(u + v)
+	print(v - u)
+	print(u * 1.5)
+
+	var p := Vector3(1, 2, 3)
+	var q := Vector3(4, 6, 8)
+	print(p + q)
+	print(q - p)
+	print(p * 0.5)
+
+	# The result is converted when stored with another type.
+	var sum: float = a + b
+	print(sum)
+
+	var total := 0
+	for i in 10:
+		total += i * i
+	print(total)
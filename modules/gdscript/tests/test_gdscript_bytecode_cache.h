@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  test_gdscript_bytecode_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_BYTECODE_CACHE_H
+#define TEST_GDSCRIPT_BYTECODE_CACHE_H
+
+#include "../gdscript.h"
+#include "../gdscript_bytecode_cache.h"
+#include "gdscript_test_utils.h"
+
+#include "core/io/marshalls.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+static const char *bytecode_cache_source = R"(
+extends RefCounted
+
+signal added(value: int)
+
+enum Mode { ADD, SUBTRACT }
+
+const NAMES: Array[String] = ["zero", "one", "two"]
+
+var total: int = 3
+var mode := Mode.ADD
+
+func add(value: int) -> int:
+	total += value if mode == Mode.ADD else -value
+	added.emit(total)
+	return total * 2
+
+func describe() -> String:
+	return "%s:%d:%s" % [NAMES[2], Vector2i(total, 1).x, str(get_reference_count() > 0)]
+)";
+
+TEST_CASE("[Modules][GDScript] Bytecode cache restores compiled scripts") {
+	Ref<GDScript> compiled = compile_test_script(bytecode_cache_source);
+	const Vector<uint8_t> data = GDScriptByteCodeCache::serialize(compiled.ptr());
+	REQUIRE_MESSAGE(!data.is_empty(), "A self-contained script should be serialized.");
+
+	Ref<GDScript> restored = memnew(GDScript);
+	restored->set_source_code(bytecode_cache_source);
+	REQUIRE(GDScriptByteCodeCache::deserialize(restored.ptr(), data));
+	CHECK(restored->is_valid());
+	CHECK(restored->has_method("add"));
+	CHECK(restored->has_script_signal("added"));
+	CHECK(restored->get_instance_base_type() == RefCounted::get_class_static());
+
+	Ref<RefCounted> instance = memnew(RefCounted);
+	instance->set_script(restored);
+	CHECK(int(instance->call("add", 4)) == 14);
+	CHECK(String(instance->call("describe")) == "two:7:true");
+	instance->set("mode", 1);
+	CHECK(int(instance->call("add", 2)) == 10);
+
+	Ref<GDScript> corrupted = memnew(GDScript);
+	ERR_PRINT_OFF;
+	CHECK_FALSE_MESSAGE(GDScriptByteCodeCache::deserialize(corrupted.ptr(), data.slice(0, data.size() / 2)), "Truncated data should be rejected.");
+	ERR_PRINT_ON;
+	CHECK_FALSE(corrupted->is_valid());
+}
+
+// Returns the offset of the given instructions in serialized data, or -1 if they aren't found.
+static int find_serialized_code(const Vector<uint8_t> &p_data, const Vector<int> &p_code) {
+	Vector<uint8_t> pattern;
+	pattern.resize(p_code.size() * 4);
+	for (int i = 0; i < p_code.size(); i++) {
+		encode_uint32(p_code[i], pattern.ptrw() + i * 4);
+	}
+	for (int i = 0; i + pattern.size() <= p_data.size(); i++) {
+		if (memcmp(p_data.ptr() + i, pattern.ptr(), pattern.size()) == 0) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+TEST_CASE("[Modules][GDScript] Bytecode cache rejects invalid bytecode") {
+	const String source = R"(
+extends RefCounted
+
+func echo(value):
+	return value
+)";
+	Ref<GDScript> compiled = compile_test_script(source);
+	const Vector<uint8_t> data = GDScriptByteCodeCache::serialize(compiled.ptr());
+	REQUIRE(!data.is_empty());
+
+	// The function ends by returning its first argument, which is on the stack after self, class and nil.
+	const int return_ofs = find_serialized_code(data, { GDScriptFunction::OPCODE_RETURN, GDScriptFunction::FIXED_ADDRESSES_MAX, GDScriptFunction::OPCODE_END });
+	REQUIRE(return_ofs >= 0);
+
+	Vector<uint8_t> bad_address = data;
+	encode_uint32(1000, bad_address.ptrw() + return_ofs + 4);
+	Ref<GDScript> restored = memnew(GDScript);
+	CHECK_FALSE_MESSAGE(GDScriptByteCodeCache::deserialize(restored.ptr(), bad_address), "An address outside of the stack should be rejected.");
+
+	Vector<uint8_t> bad_opcode = data;
+	encode_uint32(GDScriptFunction::OPCODE_END + 1, bad_opcode.ptrw() + return_ofs + 8);
+	restored.instantiate();
+	CHECK_FALSE_MESSAGE(GDScriptByteCodeCache::deserialize(restored.ptr(), bad_opcode), "An unknown opcode should be rejected.");
+
+	Vector<uint8_t> bad_jump = data;
+	encode_uint32(GDScriptFunction::OPCODE_JUMP, bad_jump.ptrw() + return_ofs);
+	encode_uint32(1000000, bad_jump.ptrw() + return_ofs + 4);
+	restored.instantiate();
+	CHECK_FALSE_MESSAGE(GDScriptByteCodeCache::deserialize(restored.ptr(), bad_jump), "A jump that doesn't land on an instruction should be rejected.");
+
+	restored.instantiate();
+	CHECK(GDScriptByteCodeCache::deserialize(restored.ptr(), data));
+}
+
+TEST_CASE("[Modules][GDScript] Bytecode cache skips scripts that can't be restored") {
+	Ref<GDScript> inner_class = compile_test_script(R"(
+extends RefCounted
+
+class Inner:
+	var value := 1
+)");
+	CHECK_MESSAGE(GDScriptByteCodeCache::serialize(inner_class.ptr()).is_empty(), "Scripts with inner classes shouldn't be serialized.");
+
+	Ref<GDScript> lambda = compile_test_script(R"(
+extends RefCounted
+
+func get_callable() -> Callable:
+	return func(): return 1
+)");
+	CHECK_MESSAGE(GDScriptByteCodeCache::serialize(lambda.ptr()).is_empty(), "Scripts with lambdas shouldn't be serialized.");
+}
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_BYTECODE_CACHE_H
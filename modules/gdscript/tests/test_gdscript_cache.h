@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*  test_gdscript_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_CACHE_H
+#define TEST_GDSCRIPT_CACHE_H
+
+#include "../gdscript.h"
+#include "../gdscript_cache.h"
+#include "../gdscript_parser.h"
+#include "gdscript_test_utils.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+static String write_cache_test_script(const String &p_file, const String &p_source) {
+	const String path = OS::get_singleton()->get_cache_path().path_join(p_file);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_source);
+	return path;
+}
+
+TEST_CASE("[Modules][GDScript] Parse scripts ahead of loading them") {
+	const String base_path = write_cache_test_script("parse_ahead_base.gd", R"(
+extends RefCounted
+
+func get_value() -> int:
+	return 1
+)");
+	const String derived_source = vformat("extends RefCounted\n\nconst Base = preload(\"%s\")\n\nfunc get_value() -> int:\n\treturn Base.new().get_value() + 1\n", base_path);
+	const String derived_path = write_cache_test_script("parse_ahead_derived.gd", derived_source);
+	Vector<String> paths;
+	paths.push_back(base_path);
+	paths.push_back(derived_path);
+
+	SUBCASE("Parsed scripts are handed over once, for the same source only") {
+		GDScriptCache::parse_scripts(paths);
+
+		Ref<GDScriptParserRef> parsed = GDScriptCache::take_parsed_script(base_path, GDScriptCache::get_source_code(base_path).hash());
+		REQUIRE(parsed.is_valid());
+		CHECK(parsed->get_status() == GDScriptParserRef::PARSED);
+		CHECK(parsed->get_parser()->get_tree() != nullptr);
+		CHECK_MESSAGE(GDScriptCache::take_parsed_script(base_path, GDScriptCache::get_source_code(base_path).hash()).is_null(), "A parsed script should only be handed over once.");
+
+		CHECK_MESSAGE(GDScriptCache::take_parsed_script(derived_path, GDScriptCache::get_source_code(derived_path).hash() + 1).is_null(), "A script parsed from another source shouldn't be handed over.");
+		GDScriptCache::clear_parsed_scripts();
+	}
+
+	SUBCASE("Loading uses the parsed scripts") {
+		GDScriptCache::parse_scripts(paths);
+
+		Ref<GDScript> derived = load_test_script(derived_path);
+		CHECK(derived->is_valid());
+		CHECK_MESSAGE(GDScriptCache::take_parsed_script(derived_path, GDScriptCache::get_source_code(derived_path).hash()).is_null(), "Loading should have used the parsed script.");
+
+		Ref<RefCounted> instance = memnew(RefCounted);
+		instance->set_script(derived);
+		CHECK(int(instance->call("get_value")) == 2);
+
+		instance.unref();
+		derived.unref();
+		GDScriptCache::clear_parsed_scripts();
+	}
+
+	GDScriptCache::remove_script(derived_path);
+	GDScriptCache::remove_script(base_path);
+	DirAccess::remove_absolute(derived_path);
+	DirAccess::remove_absolute(base_path);
+}
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_CACHE_H
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_SAMPLING_PROFILER_H
+#define TEST_GDSCRIPT_SAMPLING_PROFILER_H
+
+#ifdef DEBUG_ENABLED
+
+#include "../gdscript.h"
+#include "../gdscript_sampling_profiler.h"
+#include "gdscript_test_utils.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+static const char *sampling_profiler_source = R"(
+extends RefCounted
+
+func spin(usec: int) -> void:
+	busy(usec)
+
+func busy(usec: int) -> void:
+	var start := Time.get_ticks_usec()
+	while Time.get_ticks_usec() - start < usec:
+		pass
+)";
+
+TEST_CASE("[Modules][GDScript] Sampling profiler") {
+	Ref<GDScript> gdscript = compile_test_script(sampling_profiler_source);
+
+	Ref<RefCounted> instance = memnew(RefCounted);
+	instance->set_script(gdscript);
+
+	GDScriptSamplingProfiler::clear();
+	instance->call("spin", 20000);
+	CHECK_MESSAGE(GDScriptSamplingProfiler::get_collapsed_stacks().is_empty(), "Nothing should be sampled while the profiler isn't running.");
+
+	GDScriptSamplingProfiler::start(100);
+	instance->call("spin", 50000);
+	GDScriptSamplingProfiler::stop();
+
+	const String stacks = GDScriptSamplingProfiler::get_collapsed_stacks();
+	CHECK_MESSAGE(stacks.begins_with("spin ("), "Stacks should start from the outermost function.");
+	CHECK_MESSAGE(stacks.contains(";busy ("), "Stacks should include the called function.");
+	CHECK_MESSAGE(stacks.contains(";Time.get_ticks_usec "), "Stacks should include native calls.");
+
+	GDScriptSamplingProfiler::clear();
+	CHECK(GDScriptSamplingProfiler::get_collapsed_stacks().is_empty());
+}
+
+} // namespace GDScriptTests
+
+#endif // DEBUG_ENABLED
+
+#endif // TEST_GDSCRIPT_SAMPLING_PROFILER_H
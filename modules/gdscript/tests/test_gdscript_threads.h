@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*  test_gdscript_threads.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_THREADS_H
+#define TEST_GDSCRIPT_THREADS_H
+
+#ifdef TOOLS_ENABLED
+
+#include "../gdscript.h"
+#include "gdscript_test_utils.h"
+
+#include "core/os/os.h"
+#include "scene/main/node.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_tools.h"
+
+namespace GDScriptTests {
+
+// Untyped operations share cached evaluators in the bytecode, which all threads run.
+static const char *thread_group_source = R"(
+extends Node
+
+var velocity := Vector3()
+var position := Vector3()
+var frames := 0
+var total = 0
+
+func _process(delta: float) -> void:
+	velocity += Vector3(0, -9.8, 0) * delta
+	position += velocity * delta
+	total = total + frames
+	frames += 1
+)";
+
+TEST_CASE("[SceneTree][Modules][GDScript] Process scripts in sub-thread groups") {
+	Ref<GDScript> gdscript = compile_test_script(thread_group_source);
+
+	const int group_count = MAX(OS::get_singleton()->get_processor_count(), 2) * 4;
+	const int node_count = 10000;
+	const int frames = 10;
+
+	Node *root = memnew(Node);
+	LocalVector<Node *> groups;
+	for (int i = 0; i < group_count; i++) {
+		Node *group = memnew(Node);
+		group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		root->add_child(group);
+		groups.push_back(group);
+	}
+	LocalVector<Node *> nodes;
+	for (int i = 0; i < node_count; i++) {
+		Node *node = memnew(Node);
+		node->set_script(gdscript);
+		groups[i % group_count]->add_child(node);
+		nodes.push_back(node);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	for (int i = 0; i < frames; i++) {
+		SceneTree::get_singleton()->process(1.0 / 60.0);
+	}
+
+	const Vector3 expected_position = nodes[0]->get("position");
+	bool all_processed = true;
+	for (Node *node : nodes) {
+		if (int(node->get("frames")) != frames || int(node->get("total")) != frames * (frames - 1) / 2 || Vector3(node->get("position")) != expected_position) {
+			all_processed = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(all_processed, "Every node should have been processed once per frame.");
+	CHECK(int(nodes[0]->get("frames")) == frames);
+
+	memdelete(root);
+}
+
+static const char *thread_group_access_source = R"(
+extends Node
+
+var target: Node
+var value := 0
+var read = null
+
+func _process(_delta: float) -> void:
+	if target:
+		target.set("value", 1)
+		read = target.get("value")
+		target = null
+)";
+
+TEST_CASE("[SceneTree][Modules][GDScript] Access script members of nodes in other thread groups") {
+	Ref<GDScript> gdscript = compile_test_script(thread_group_access_source);
+
+	Node *root = memnew(Node);
+	Node *groups[2];
+	Node *nodes[2][2];
+	for (int i = 0; i < 2; i++) {
+		groups[i] = memnew(Node);
+		groups[i]->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		root->add_child(groups[i]);
+		for (int j = 0; j < 2; j++) {
+			nodes[i][j] = memnew(Node);
+			nodes[i][j]->set_script(gdscript);
+			groups[i]->add_child(nodes[i][j]);
+		}
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	ErrorDetector error_detector;
+
+	SUBCASE("Node in another thread group") {
+		nodes[0][0]->set("target", nodes[1][0]);
+		ERR_PRINT_OFF;
+		SceneTree::get_singleton()->process(1.0 / 60.0);
+		ERR_PRINT_ON;
+		CHECK_MESSAGE(error_detector.has_error, "Accessing the script members of a node in another thread group should fail.");
+		CHECK(int(nodes[1][0]->get("value")) == 0);
+		CHECK(nodes[0][0]->get("read") == Variant());
+	}
+
+	SUBCASE("Node in the same thread group") {
+		nodes[0][0]->set("target", nodes[0][1]);
+		SceneTree::get_singleton()->process(1.0 / 60.0);
+		CHECK_FALSE(error_detector.has_error);
+		CHECK(int(nodes[0][1]->get("value")) == 1);
+		CHECK(int(nodes[0][0]->get("read")) == 1);
+	}
+
+	memdelete(root);
+}
+
+} // namespace GDScriptTests
+
+#endif // TOOLS_ENABLED
+
+#endif // TEST_GDSCRIPT_THREADS_H
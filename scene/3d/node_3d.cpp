@@ -108,10 +108,22 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+#ifdef TOOLS_ENABLED
+	// Gizmos also need to be notified, but they are not counted.
+	const bool can_skip_dirty = !Engine::get_singleton()->is_editor_hint();
+#else
+	const bool can_skip_dirty = true;
+#endif
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
+		if (can_skip_dirty && E->data.subtree_notify_transform_count == 0 && E->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+			// The global transform of a node is only cleaned after the one of its parent, so if this one
+			// is dirty, so are all its descendants. None of them needs to be notified either.
+			continue;
+		}
 		E->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
@@ -129,6 +141,12 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
 }
 
+void Node3D::_add_subtree_notify_transform_count(int32_t p_count) {
+	for (Node3D *node = this; node; node = node->data.parent) {
+		node->data.subtree_notify_transform_count += p_count;
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -142,6 +160,9 @@ void Node3D::_notification(int p_what) {
 
 			if (data.parent) {
 				data.C = data.parent->data.children.push_back(this);
+				if (data.subtree_notify_transform_count) {
+					data.parent->_add_subtree_notify_transform_count(data.subtree_notify_transform_count);
+				}
 			} else {
 				data.C = nullptr;
 			}
@@ -173,6 +194,9 @@ void Node3D::_notification(int p_what) {
 			}
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
+				if (data.subtree_notify_transform_count) {
+					data.parent->_add_subtree_notify_transform_count(-int32_t(data.subtree_notify_transform_count));
+				}
 			}
 			data.parent = nullptr;
 			data.C = nullptr;
@@ -958,7 +982,11 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (data.notify_transform == p_enabled) {
+		return;
+	}
 	data.notify_transform = p_enabled;
+	_add_subtree_notify_transform_count(p_enabled ? 1 : -1);
 }
 
 bool Node3D::is_transform_notification_enabled() const {
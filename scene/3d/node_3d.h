@@ -113,6 +113,7 @@ private:
 		bool ignore_notification = false;
 		bool notify_local_transform = false;
 		bool notify_transform = false;
+		uint32_t subtree_notify_transform_count = 0; // Nodes with `notify_transform` in this subtree, including itself.
 
 		bool visible = true;
 		bool disable_scale = false;
@@ -137,6 +138,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _add_subtree_notify_transform_count(int32_t p_count);
 
 	void _propagate_visibility_changed();
 
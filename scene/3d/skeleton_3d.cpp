@@ -31,6 +31,8 @@
 #include "skeleton_3d.h"
 #include "skeleton_3d.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 #include "core/variant/type_info.h"
 #include "scene/3d/physics/physical_bone_3d.h"
 #include "scene/3d/physics/physics_body_3d.h"
@@ -253,6 +255,126 @@ void Skeleton3D::_update_process_order() {
 	process_order_dirty = false;
 }
 
+LocalVector<ObjectID> Skeleton3D::skin_update_queue;
+
+void Skeleton3D::_prepare_skin_update(SkinReference *p_skin_ref) {
+	const Skin *skin = p_skin_ref->skin.operator->();
+	const Bone *bonesptr = bones.ptr();
+	int len = bones.size();
+	uint32_t bind_count = skin->get_bind_count();
+
+	if (p_skin_ref->bind_count != bind_count) {
+		RS::get_singleton()->skeleton_allocate_data(p_skin_ref->skeleton, bind_count);
+		p_skin_ref->bind_count = bind_count;
+		p_skin_ref->skin_bone_indices.resize(bind_count);
+		p_skin_ref->skin_bone_indices_ptrs = p_skin_ref->skin_bone_indices.ptrw();
+		p_skin_ref->skin_transforms.resize(bind_count);
+	}
+
+	if (p_skin_ref->skeleton_version != version) {
+		for (uint32_t i = 0; i < bind_count; i++) {
+			StringName bind_name = skin->get_bind_name(i);
+
+			if (bind_name != StringName()) {
+				// Bind name used, use this.
+				bool found = false;
+				for (int j = 0; j < len; j++) {
+					if (bonesptr[j].name == bind_name) {
+						p_skin_ref->skin_bone_indices_ptrs[i] = j;
+						found = true;
+						break;
+					}
+				}
+
+				if (!found) {
+					ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
+					p_skin_ref->skin_bone_indices_ptrs[i] = 0;
+				}
+			} else if (skin->get_bind_bone(i) >= 0) {
+				int bind_index = skin->get_bind_bone(i);
+				if (bind_index >= len) {
+					ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
+					p_skin_ref->skin_bone_indices_ptrs[i] = 0;
+				} else {
+					p_skin_ref->skin_bone_indices_ptrs[i] = bind_index;
+				}
+			} else {
+				ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
+				p_skin_ref->skin_bone_indices_ptrs[i] = 0;
+			}
+		}
+
+		p_skin_ref->skeleton_version = version;
+	}
+}
+
+void Skeleton3D::_compute_skin_transforms(SkinReference *p_skin_ref) const {
+	const Skin *skin = p_skin_ref->skin.operator->();
+	const Bone *bonesptr = bones.ptr();
+	uint32_t len = bones.size();
+	uint32_t bind_count = p_skin_ref->bind_count;
+	Transform3D *transforms = p_skin_ref->skin_transforms.ptrw();
+
+	for (uint32_t i = 0; i < bind_count; i++) {
+		uint32_t bone_index = p_skin_ref->skin_bone_indices_ptrs[i];
+		ERR_CONTINUE(bone_index >= len);
+		transforms[i] = bonesptr[bone_index].pose_global * skin->get_bind_pose(i);
+	}
+}
+
+void Skeleton3D::_update_skins() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (SkinReference *E : skin_bindings) {
+		_prepare_skin_update(E);
+		_compute_skin_transforms(E);
+		rs->skeleton_set_bone_transforms(E->skeleton, E->skin_transforms);
+	}
+}
+
+void Skeleton3D::_skin_update_task(void *p_userdata, uint32_t p_index) {
+	SkinReference *skin_ref = static_cast<SkinReference **>(p_userdata)[p_index];
+	skin_ref->skeleton_node->_compute_skin_transforms(skin_ref);
+}
+
+void Skeleton3D::_process_skin_updates() {
+	LocalVector<ObjectID> queue;
+	SWAP(queue, skin_update_queue);
+
+	// Bind indices are resolved serially, since it may allocate server data and print errors.
+	LocalVector<SkinReference *> skin_refs;
+	for (const ObjectID &id : queue) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(id));
+		if (!skeleton) {
+			continue;
+		}
+		skeleton->skin_update_queued = false;
+		for (SkinReference *E : skeleton->skin_bindings) {
+			skeleton->_prepare_skin_update(E);
+			skin_refs.push_back(E);
+		}
+	}
+
+	if (skin_refs.size() == 1) {
+		_skin_update_task(skin_refs.ptr(), 0);
+	} else if (skin_refs.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Skeleton3D::_skin_update_task, skin_refs.ptr(), skin_refs.size(), -1, true, SNAME("Skeleton3DSkinUpdate"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (SkinReference *E : skin_refs) {
+		rs->skeleton_set_bone_transforms(E->skeleton, E->skin_transforms);
+	}
+
+	// Only notify once the skins are uploaded. Callbacks may free skeletons, so look them up again.
+	for (const ObjectID &id : queue) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(id));
+		if (skeleton) {
+			skeleton->emit_signal(SceneStringNames::get_singleton()->pose_updated);
+		}
+	}
+}
+
 void Skeleton3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -261,70 +383,24 @@ void Skeleton3D::_notification(int p_what) {
 			}
 		} break;
 		case NOTIFICATION_UPDATE_SKELETON: {
-			RenderingServer *rs = RenderingServer::get_singleton();
-			Bone *bonesptr = bones.ptrw();
-
-			int len = bones.size();
 			dirty = false;
 
 			// Update bone transforms.
 			force_update_all_bone_transforms();
 
-			// Update skins.
-			for (SkinReference *E : skin_bindings) {
-				const Skin *skin = E->skin.operator->();
-				RID skeleton = E->skeleton;
-				uint32_t bind_count = skin->get_bind_count();
-
-				if (E->bind_count != bind_count) {
-					RS::get_singleton()->skeleton_allocate_data(skeleton, bind_count);
-					E->bind_count = bind_count;
-					E->skin_bone_indices.resize(bind_count);
-					E->skin_bone_indices_ptrs = E->skin_bone_indices.ptrw();
-				}
-
-				if (E->skeleton_version != version) {
-					for (uint32_t i = 0; i < bind_count; i++) {
-						StringName bind_name = skin->get_bind_name(i);
-
-						if (bind_name != StringName()) {
-							// Bind name used, use this.
-							bool found = false;
-							for (int j = 0; j < len; j++) {
-								if (bonesptr[j].name == bind_name) {
-									E->skin_bone_indices_ptrs[i] = j;
-									found = true;
-									break;
-								}
-							}
-
-							if (!found) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
-								E->skin_bone_indices_ptrs[i] = 0;
-							}
-						} else if (skin->get_bind_bone(i) >= 0) {
-							int bind_index = skin->get_bind_bone(i);
-							if (bind_index >= len) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
-								E->skin_bone_indices_ptrs[i] = 0;
-							} else {
-								E->skin_bone_indices_ptrs[i] = bind_index;
-							}
-						} else {
-							ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
-							E->skin_bone_indices_ptrs[i] = 0;
-						}
-					}
-
-					E->skeleton_version = version;
-				}
-
-				for (uint32_t i = 0; i < bind_count; i++) {
-					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+			// Update skins. When they are queued, pose_updated is emitted once they are uploaded.
+			if (skin_update_queued) {
+				break;
+			}
+			if (Thread::is_main_thread() && !skin_bindings.is_empty()) {
+				if (skin_update_queue.is_empty()) {
+					callable_mp_static(&Skeleton3D::_process_skin_updates).call_deferred();
 				}
+				skin_update_queue.push_back(get_instance_id());
+				skin_update_queued = true;
+				break;
 			}
+			_update_skins();
 			emit_signal(SceneStringNames::get_singleton()->pose_updated);
 		} break;
 
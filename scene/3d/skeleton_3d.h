@@ -42,6 +42,7 @@ class Skeleton3D;
 class SkinReference : public RefCounted {
 	GDCLASS(SkinReference, RefCounted)
 	friend class Skeleton3D;
+	friend class TestSkeleton3DInternalsAccessor;
 
 	Skeleton3D *skeleton_node = nullptr;
 	RID skeleton;
@@ -50,6 +51,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	Vector<Transform3D> skin_transforms;
 
 protected:
 	static void _bind_methods();
@@ -68,6 +70,7 @@ class Skeleton3D : public Node3D {
 
 private:
 	friend class SkinReference;
+	friend class TestSkeleton3DInternalsAccessor;
 
 	struct Bone {
 		String name;
@@ -120,6 +123,16 @@ private:
 
 	void _skin_changed();
 
+	// Skins of the skeletons updated on the main thread are computed together, see _process_skin_updates().
+	bool skin_update_queued = false;
+	static LocalVector<ObjectID> skin_update_queue;
+
+	void _prepare_skin_update(SkinReference *p_skin_ref);
+	void _compute_skin_transforms(SkinReference *p_skin_ref) const;
+	void _update_skins();
+	static void _skin_update_task(void *p_userdata, uint32_t p_index);
+	static void _process_skin_updates();
+
 	bool animate_physical_bones = true;
 	Vector<Bone> bones;
 	bool process_order_dirty = false;
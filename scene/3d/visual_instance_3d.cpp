@@ -57,7 +57,13 @@ void VisualInstance3D::_notification(int p_what) {
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
 			Transform3D gt = get_global_transform();
-			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			SceneTree *tree = get_tree();
+			if (tree) {
+				// Batched while the tree flushes transform notifications.
+				tree->set_instance_transform(instance, gt);
+			} else {
+				RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
@@ -33,15 +33,20 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "scene/2d/visible_on_screen_notifier_2d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/viewport.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
 
 #ifndef _3D_DISABLED
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
@@ -525,6 +530,52 @@ int AnimationMixer::get_audio_max_polyphony() const {
 	return audio_max_polyphony;
 }
 
+void AnimationMixer::set_lod_update_interval(double p_interval) {
+	ERR_FAIL_COND(p_interval < 0.0);
+	lod_update_interval = p_interval;
+}
+
+double AnimationMixer::get_lod_update_interval() const {
+	return lod_update_interval;
+}
+
+void AnimationMixer::set_lod_distance(real_t p_distance) {
+	ERR_FAIL_COND(p_distance < 0.0);
+	lod_distance = p_distance;
+}
+
+real_t AnimationMixer::get_lod_distance() const {
+	return lod_distance;
+}
+
+void AnimationMixer::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+}
+
+NodePath AnimationMixer::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+void AnimationMixer::set_lod_interpolate(bool p_interpolate) {
+	lod_interpolate = p_interpolate;
+}
+
+bool AnimationMixer::is_lod_interpolating() const {
+	return lod_interpolate;
+}
+
+void AnimationMixer::set_lod_skip_secondary_tracks(bool p_skip) {
+	lod_skip_secondary_tracks = p_skip;
+}
+
+bool AnimationMixer::is_lod_skipping_secondary_tracks() const {
+	return lod_skip_secondary_tracks;
+}
+
+bool AnimationMixer::is_lod_reduced() const {
+	return lod_reduced;
+}
+
 #ifdef TOOLS_ENABLED
 void AnimationMixer::set_editing(bool p_editing) {
 	if (editing == p_editing) {
@@ -566,6 +617,7 @@ void AnimationMixer::_clear_caches() {
 		memdelete(K.value);
 	}
 	track_cache.clear();
+	animation_track_caches.clear();
 	cache_valid = false;
 	capture_cache.clear();
 
@@ -615,6 +667,16 @@ bool AnimationMixer::_update_caches() {
 	bool check_path = GLOBAL_GET("animation/warnings/check_invalid_track_paths");
 	bool check_angle_interpolation = GLOBAL_GET("animation/warnings/check_angle_interpolation_type_conflicting");
 
+	parallel_blending = GLOBAL_GET("animation/mixers/parallel_blending");
+#ifdef TOOLS_ENABLED
+	parallel_blending = parallel_blending && !Engine::get_singleton()->is_editor_hint();
+#endif // TOOLS_ENABLED
+	// Scripted post-processing may access anything, keep it on the main thread.
+	blend_thread_safe = !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+#ifndef _3D_DISABLED
+	motion_scales_valid = false;
+#endif // _3D_DISABLED
+
 	Node *parent = get_node_or_null(root_node);
 	if (!parent) {
 		cache_valid = false;
@@ -884,6 +946,13 @@ bool AnimationMixer::_update_caches() {
 				}
 			}
 
+			// Method, audio and animation tracks, as well as discrete values, are executed while blending.
+			if (track_cache_type == Animation::TYPE_METHOD || track_cache_type == Animation::TYPE_AUDIO || track_cache_type == Animation::TYPE_ANIMATION) {
+				blend_thread_safe = false;
+			} else if (track_cache_type == Animation::TYPE_VALUE && (!static_cast<TrackCacheValue *>(track)->is_variant_interpolatable || (track_src_type == Animation::TYPE_VALUE && anim->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE))) {
+				blend_thread_safe = false;
+			}
+
 			track->setup_pass = setup_pass;
 		}
 	}
@@ -913,8 +982,30 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		K.value->blend_idx = track_map[K.value->path];
+	}
+
+	animation_track_caches.clear();
+	for (const StringName &E : sname) {
+		Ref<Animation> anim = get_animation(E);
+		AnimationTrackCaches &track_caches = animation_track_caches[anim->get_instance_id()];
+		track_caches.tracks.resize(anim->get_track_count());
+		track_caches.cursors.resize(anim->get_track_count());
+		for (int i = 0; i < anim->get_track_count(); i++) {
+			TrackCache **track = track_cache.getptr(anim->track_get_type_hash(i));
+			track_caches.tracks[i] = track ? *track : nullptr;
+		}
+	}
+
 	cache_valid = true;
 
+#ifndef _3D_DISABLED
+	if (parallel_blending && Thread::is_main_thread()) {
+		_update_motion_scales();
+	}
+#endif // _3D_DISABLED
+
 	return true;
 }
 
@@ -934,6 +1025,255 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+LocalVector<AnimationMixer::ParallelBlend> AnimationMixer::parallel_blends;
+
+void AnimationMixer::_process_internal(double p_delta) {
+	if (!_lod_process(p_delta)) {
+		return;
+	}
+
+	if (!parallel_blending) {
+		_process_animation(p_delta);
+		return;
+	}
+
+	if (Thread::is_main_thread()) {
+		if (cache_valid && blend_thread_safe) {
+			// Blend together with the other mixers processed this frame, see _process_parallel_blends().
+			if (parallel_blends.is_empty()) {
+				callable_mp_static(&AnimationMixer::_process_parallel_blends).call_deferred();
+			}
+			ParallelBlend pb;
+			pb.mixer_id = get_instance_id();
+			pb.delta = p_delta;
+			parallel_blends.push_back(pb);
+		} else {
+			_process_animation(p_delta);
+		}
+		return;
+	}
+
+	// Processed in a sub-thread group. The blend result is computed here,
+	// but the tracked nodes may belong to other groups, so they are written on the main thread.
+	if (!cache_valid || !blend_thread_safe) {
+		callable_mp(this, &AnimationMixer::_process_animation).call_deferred(p_delta, false);
+		return;
+	}
+	_blend_init();
+	if (_blend_pre_process(p_delta, track_count, track_map)) {
+		_blend_capture(p_delta);
+		_blend_calc_total_weight();
+		bool can_blend_here = blend_thread_safe;
+#ifndef _3D_DISABLED
+		// Motion scales are only read from skeletons on the main thread, see _update_motion_scales().
+		can_blend_here = can_blend_here && motion_scales_valid;
+#endif // _3D_DISABLED
+		if (!can_blend_here) {
+			// The caches were rebuilt above, blend on the main thread this time.
+			callable_mp(this, &AnimationMixer::_blend_process_deferred).call_deferred(p_delta);
+			return;
+		}
+		_blend_process(p_delta);
+		callable_mp(this, &AnimationMixer::_blend_apply_deferred).call_deferred();
+		return;
+	}
+	clear_animation_instances();
+}
+
+void AnimationMixer::_blend_process_deferred(double p_delta) {
+	_blend_process(p_delta);
+	_blend_apply_deferred();
+}
+
+void AnimationMixer::_blend_apply_deferred() {
+	_blend_apply();
+	_blend_post_process();
+	clear_animation_instances();
+#ifndef _3D_DISABLED
+	// For the next blend computed in a sub-thread group.
+	_update_motion_scales();
+#endif // _3D_DISABLED
+}
+
+#ifndef _3D_DISABLED
+void AnimationMixer::_update_motion_scales() {
+	motion_scales.clear();
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		if (K.value->type != Animation::TYPE_POSITION_3D) {
+			continue;
+		}
+		TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+		if (t->bone_idx < 0 || motion_scales.has(t->skeleton_id)) {
+			continue;
+		}
+		Skeleton3D *skel = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(t->skeleton_id));
+		if (skel) {
+			motion_scales[t->skeleton_id] = skel->get_motion_scale();
+		}
+	}
+	motion_scales_valid = true;
+}
+#endif // _3D_DISABLED
+
+/* -------------------------------------------- */
+/* -- Level of detail ------------------------- */
+/* -------------------------------------------- */
+
+void AnimationMixer::_update_lod() {
+	lod_reduced = false;
+
+	if (!lod_visibility_notifier.is_empty()) {
+		Node *notifier = get_node_or_null(lod_visibility_notifier);
+		VisibleOnScreenNotifier2D *notifier_2d = Object::cast_to<VisibleOnScreenNotifier2D>(notifier);
+		if (notifier_2d && !notifier_2d->is_on_screen()) {
+			lod_reduced = true;
+			return;
+		}
+#ifndef _3D_DISABLED
+		VisibleOnScreenNotifier3D *notifier_3d = Object::cast_to<VisibleOnScreenNotifier3D>(notifier);
+		if (notifier_3d && !notifier_3d->is_on_screen()) {
+			lod_reduced = true;
+			return;
+		}
+#endif // _3D_DISABLED
+	}
+
+#ifndef _3D_DISABLED
+	if (lod_distance > 0.0 && is_inside_tree()) {
+		Node3D *root = Object::cast_to<Node3D>(get_node_or_null(root_node));
+		Camera3D *camera = get_viewport()->get_camera_3d();
+		if (root && camera && root->is_inside_tree()) {
+			lod_reduced = camera->get_global_position().distance_squared_to(root->get_global_position()) > lod_distance * lod_distance;
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+bool AnimationMixer::_lod_process(double &r_delta) {
+	if (lod_update_interval <= 0.0 || (lod_distance <= 0.0 && lod_visibility_notifier.is_empty())) {
+		lod_reduced = false;
+	} else if (Thread::is_main_thread()) {
+		_update_lod();
+	} else {
+		// The camera and the notifier may belong to other groups, check them on the main thread for the next update.
+		callable_mp(this, &AnimationMixer::_update_lod).call_deferred();
+	}
+
+	if (!lod_reduced) {
+		// Catch up with the time elapsed since the last reduced update.
+		r_delta += lod_elapsed;
+		lod_elapsed = 0.0;
+		return true;
+	}
+
+	lod_elapsed += r_delta;
+	if (lod_elapsed < lod_update_interval) {
+		// The motion until the next update is reported by it.
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		if (lod_interpolate) {
+			real_t weight = lod_elapsed / lod_update_interval;
+			if (Thread::is_main_thread()) {
+				_lod_apply_interpolated(weight);
+			} else {
+				callable_mp(this, &AnimationMixer::_lod_apply_interpolated).call_deferred(weight);
+			}
+		}
+		return false;
+	}
+
+	r_delta = lod_elapsed;
+	lod_elapsed = 0.0;
+	return true;
+}
+
+void AnimationMixer::_lod_apply_interpolated(real_t p_weight) {
+#ifndef _3D_DISABLED
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		const TrackCache *track = K.value;
+		if (track->type != Animation::TYPE_POSITION_3D || track->root_motion) {
+			continue;
+		}
+		if (!deterministic && Math::is_zero_approx(track->total_weight)) {
+			continue;
+		}
+		const TrackCacheTransform *t = static_cast<const TrackCacheTransform *>(track);
+		if (!t->lod_valid) {
+			continue;
+		}
+		if (!_apply_transform(t, t->lod_from_loc.lerp(t->lod_to_loc, p_weight), t->lod_from_rot.slerp(t->lod_to_rot, p_weight), t->lod_from_scale.lerp(t->lod_to_scale, p_weight))) {
+			return;
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+void AnimationMixer::_parallel_blend_task(void *p_userdata, uint32_t p_index) {
+	ParallelBlend &pb = static_cast<ParallelBlend *>(p_userdata)[p_index];
+	pb.mixer->_blend_process(pb.delta);
+}
+
+void AnimationMixer::_process_parallel_blends() {
+	LocalVector<ParallelBlend> blends;
+	SWAP(blends, parallel_blends);
+
+	// Playback state is advanced serially, since it may emit signals or evaluate scripted nodes.
+	LocalVector<ParallelBlend> to_blend;
+	for (ParallelBlend &pb : blends) {
+		pb.mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(pb.mixer_id));
+		if (!pb.mixer || !pb.mixer->is_inside_tree()) {
+			continue;
+		}
+		AnimationMixer *mixer = pb.mixer;
+		mixer->_blend_init();
+		if (!mixer->_blend_pre_process(pb.delta, mixer->track_count, mixer->track_map)) {
+			mixer->clear_animation_instances();
+			continue;
+		}
+		mixer->_blend_capture(pb.delta);
+		mixer->_blend_calc_total_weight();
+		if (mixer->blend_thread_safe) {
+#ifndef _3D_DISABLED
+			mixer->_update_motion_scales();
+#endif // _3D_DISABLED
+			to_blend.push_back(pb);
+		} else {
+			// Caches were rebuilt with tracks that must be executed on the main thread.
+			mixer->_blend_process(pb.delta);
+			mixer->_blend_apply_deferred();
+		}
+	}
+
+	// Scripts evaluated above may have freed some of the mixers.
+	for (uint32_t i = 0; i < to_blend.size(); i++) {
+		if (!ObjectDB::get_instance(to_blend[i].mixer_id)) {
+			to_blend.remove_at(i);
+			i--;
+		}
+	}
+
+	if (to_blend.is_empty()) {
+		return;
+	}
+
+	if (to_blend.size() == 1) {
+		_parallel_blend_task(to_blend.ptr(), 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_parallel_blend_task, to_blend.ptr(), to_blend.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Writing the results and emitting signals happens on the main thread, in the order the mixers were processed.
+	for (const ParallelBlend &pb : to_blend) {
+		// A previously applied mixer may have freed this one.
+		AnimationMixer *mixer = Object::cast_to<AnimationMixer>(ObjectDB::get_instance(pb.mixer_id));
+		if (mixer) {
+			mixer->_blend_apply_deferred();
+		}
+	}
+}
+
 Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx) {
 	Variant res;
 	if (GDVIRTUAL_CALL(_post_process_key_value, p_anim, p_track, p_value, p_object_id, p_object_sub_idx, res)) {
@@ -947,6 +1287,14 @@ Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, in
 	switch (p_anim->track_get_type(p_track)) {
 		case Animation::TYPE_POSITION_3D: {
 			if (p_object_sub_idx >= 0) {
+				if (!Thread::is_main_thread()) {
+					// Blending on another thread, where the skeleton can't be accessed.
+					const float *motion_scale = motion_scales.getptr(p_object_id);
+					if (motion_scale) {
+						return Vector3(p_value) * *motion_scale;
+					}
+					return p_value;
+				}
 				Skeleton3D *skel = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(p_object_id));
 				if (skel) {
 					return Vector3(p_value) * skel->get_motion_scale();
@@ -1063,28 +1411,35 @@ void AnimationMixer::blend_capture(double p_delta) {
 }
 
 void AnimationMixer::_blend_calc_total_weight() {
+	// Marks the blend indices already weighted for the current animation instance.
+	LocalVector<uint32_t> processed_passes;
+	processed_passes.resize(track_count);
+	for (uint32_t &pass : processed_passes) {
+		pass = 0;
+	}
+	uint32_t weight_pass = 0;
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		real_t weight = ai.playback_info.weight;
 		Vector<real_t> track_weights = ai.playback_info.track_weights;
-		Vector<int> processed_indices;
+		const AnimationTrackCaches *track_caches = _get_animation_track_caches(a);
+		weight_pass++;
 		for (int i = 0; i < a->get_track_count(); i++) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
-			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache *track = _get_track_cache(a, i, track_caches);
+			if (!track) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			int blend_idx = track_map[track->path];
-			if (processed_indices.has(blend_idx)) {
-				continue; // There is the case different track type with same path... Is there more faster iterating way than has()?
-			}
+			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
+			if (processed_passes[blend_idx] == weight_pass) {
+				continue; // There is the case different track type with same path.
+			}
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			track->total_weight += blend;
-			processed_indices.push_back(blend_idx);
+			processed_passes[blend_idx] = weight_pass;
 		}
 	}
 }
@@ -1094,6 +1449,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
 #endif // TOOLS_ENABLED
+	bool skip_secondary_tracks = lod_reduced && lod_skip_secondary_tracks;
 	for (const AnimationInstance &ai : animation_instances) {
 		Ref<Animation> a = ai.animation_data.animation;
 		double time = ai.playback_info.time;
@@ -1108,17 +1464,19 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		bool calc_root = !seeked || is_external_seeking;
 #endif // _3D_DISABLED
 
+		AnimationTrackCaches *track_caches = _get_animation_track_caches(a);
 		for (int i = 0; i < a->get_track_count(); i++) {
 			if (!a->track_is_enabled(i)) {
 				continue;
 			}
-			Animation::TypeHash thash = a->track_get_type_hash(i);
-			if (!track_cache.has(thash)) {
+			TrackCache *track = _get_track_cache(a, i, track_caches);
+#ifndef _3D_DISABLED
+			Animation::TrackCursor *cursor = track_caches ? &track_caches->cursors[i] : nullptr;
+#endif // _3D_DISABLED
+			if (!track) {
 				continue; // No path, but avoid error spamming.
 			}
-			TrackCache *track = track_cache[thash];
-			ERR_CONTINUE(!track_map.has(track->path));
-			int blend_idx = track_map[track->path];
+			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights.size() ? track_weights[blend_idx] * weight : weight;
 			if (!deterministic) {
@@ -1130,6 +1488,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = a->track_get_type(i);
+			if (skip_secondary_tracks && (ttype == Animation::TYPE_METHOD || ttype == Animation::TYPE_AUDIO || ttype == Animation::TYPE_BLEND_SHAPE)) {
+				continue;
+			}
 			track->root_motion = root_motion_track == a->track_get_path(i);
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1211,7 +1572,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = a->try_position_track_interpolate(i, time, &loc, false, cursor);
 						if (err != OK) {
 							continue;
 						}
@@ -1298,7 +1659,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = a->try_rotation_track_interpolate(i, time, &rot, false, cursor);
 						if (err != OK) {
 							continue;
 						}
@@ -1386,7 +1747,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = a->try_scale_track_interpolate(i, time, &scale, false, cursor);
 						if (err != OK) {
 							continue;
 						}
@@ -1402,7 +1763,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = a->try_blend_shape_track_interpolate(i, time, &value, false, cursor);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -1669,7 +2030,47 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 	}
 }
 
+#ifndef _3D_DISABLED
+bool AnimationMixer::_apply_transform(const TrackCacheTransform *p_track, const Vector3 &p_loc, const Quaternion &p_rot, const Vector3 &p_scale) {
+	if (p_track->skeleton_id.is_valid() && p_track->bone_idx >= 0) {
+		Skeleton3D *t_skeleton = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(p_track->skeleton_id));
+		if (!t_skeleton) {
+			return false;
+		}
+		if (p_track->loc_used) {
+			t_skeleton->set_bone_pose_position(p_track->bone_idx, p_loc);
+		}
+		if (p_track->rot_used) {
+			t_skeleton->set_bone_pose_rotation(p_track->bone_idx, p_rot);
+		}
+		if (p_track->scale_used) {
+			t_skeleton->set_bone_pose_scale(p_track->bone_idx, p_scale);
+		}
+	} else if (!p_track->skeleton_id.is_valid()) {
+		Node3D *t_node_3d = Object::cast_to<Node3D>(ObjectDB::get_instance(p_track->object_id));
+		if (!t_node_3d) {
+			return false;
+		}
+		if (p_track->loc_used) {
+			t_node_3d->set_position(p_loc);
+		}
+		if (p_track->rot_used) {
+			t_node_3d->set_rotation(p_rot.get_euler());
+		}
+		if (p_track->scale_used) {
+			t_node_3d->set_scale(p_scale);
+		}
+	}
+	return true;
+}
+#endif // _3D_DISABLED
+
 void AnimationMixer::_blend_apply() {
+#ifndef _3D_DISABLED
+	bool lod_interpolating = lod_reduced && lod_interpolate && lod_update_interval > 0.0;
+	bool skip_secondary_tracks = lod_reduced && lod_skip_secondary_tracks;
+#endif // _3D_DISABLED
+
 	// Finally, set the tracks.
 	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
 		TrackCache *track = K.value;
@@ -1688,40 +2089,36 @@ void AnimationMixer::_blend_apply() {
 					root_motion_position_accumulator = t->loc;
 					root_motion_rotation_accumulator = t->rot;
 					root_motion_scale_accumulator = t->scale;
-				} else if (t->skeleton_id.is_valid() && t->bone_idx >= 0) {
-					Skeleton3D *t_skeleton = Object::cast_to<Skeleton3D>(ObjectDB::get_instance(t->skeleton_id));
-					if (!t_skeleton) {
-						return;
-					}
-					if (t->loc_used) {
-						t_skeleton->set_bone_pose_position(t->bone_idx, t->loc);
+				} else if (lod_interpolating) {
+					// Show the previous update first, then move towards this one until the next update.
+					if (!t->lod_valid) {
+						t->lod_to_loc = t->loc;
+						t->lod_to_rot = t->rot.normalized();
+						t->lod_to_scale = t->scale;
+						t->lod_valid = true;
 					}
-					if (t->rot_used) {
-						t_skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-					}
-					if (t->scale_used) {
-						t_skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
-					}
-
-				} else if (!t->skeleton_id.is_valid()) {
-					Node3D *t_node_3d = Object::cast_to<Node3D>(ObjectDB::get_instance(t->object_id));
-					if (!t_node_3d) {
+					t->lod_from_loc = t->lod_to_loc;
+					t->lod_from_rot = t->lod_to_rot;
+					t->lod_from_scale = t->lod_to_scale;
+					t->lod_to_loc = t->loc;
+					t->lod_to_rot = t->rot.normalized();
+					t->lod_to_scale = t->scale;
+					if (!_apply_transform(t, t->lod_from_loc, t->lod_from_rot, t->lod_from_scale)) {
 						return;
 					}
-					if (t->loc_used) {
-						t_node_3d->set_position(t->loc);
-					}
-					if (t->rot_used) {
-						t_node_3d->set_rotation(t->rot.get_euler());
-					}
-					if (t->scale_used) {
-						t_node_3d->set_scale(t->scale);
+				} else {
+					t->lod_valid = false;
+					if (!_apply_transform(t, t->loc, t->rot, t->scale)) {
+						return;
 					}
 				}
 #endif // _3D_DISABLED
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 #ifndef _3D_DISABLED
+				if (skip_secondary_tracks) {
+					break; // Keep the last value.
+				}
 				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 
 				MeshInstance3D *t_mesh_3d = Object::cast_to<MeshInstance3D>(ObjectDB::get_instance(t->object_id));
@@ -2139,13 +2536,13 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				_process_internal(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				_process_internal(get_physics_process_delta_time());
 			}
 		} break;
 
@@ -2212,6 +2609,24 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_audio_max_polyphony", "max_polyphony"), &AnimationMixer::set_audio_max_polyphony);
 	ClassDB::bind_method(D_METHOD("get_audio_max_polyphony"), &AnimationMixer::get_audio_max_polyphony);
 
+	/* ---- Level of detail ---- */
+	ClassDB::bind_method(D_METHOD("set_lod_update_interval", "interval"), &AnimationMixer::set_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval"), &AnimationMixer::get_lod_update_interval);
+
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationMixer::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationMixer::get_lod_distance);
+
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationMixer::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationMixer::get_lod_visibility_notifier);
+
+	ClassDB::bind_method(D_METHOD("set_lod_interpolate", "enabled"), &AnimationMixer::set_lod_interpolate);
+	ClassDB::bind_method(D_METHOD("is_lod_interpolating"), &AnimationMixer::is_lod_interpolating);
+
+	ClassDB::bind_method(D_METHOD("set_lod_skip_secondary_tracks", "enabled"), &AnimationMixer::set_lod_skip_secondary_tracks);
+	ClassDB::bind_method(D_METHOD("is_lod_skipping_secondary_tracks"), &AnimationMixer::is_lod_skipping_secondary_tracks);
+
+	ClassDB::bind_method(D_METHOD("is_lod_reduced"), &AnimationMixer::is_lod_reduced);
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	ClassDB::bind_method(D_METHOD("set_root_motion_track", "path"), &AnimationMixer::set_root_motion_track);
 	ClassDB::bind_method(D_METHOD("get_root_motion_track"), &AnimationMixer::get_root_motion_track);
@@ -2249,6 +2664,13 @@ void AnimationMixer::_bind_methods() {
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_update_interval", PROPERTY_HINT_RANGE, "0,1,0.001,or_greater,suffix:s"), "set_lod_update_interval", "get_lod_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibleOnScreenNotifier2D,VisibleOnScreenNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_interpolate"), "set_lod_interpolate", "is_lod_interpolating");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_skip_secondary_tracks"), "set_lod_skip_secondary_tracks", "is_lod_skipping_secondary_tracks");
+
 	ADD_GROUP("Callback Mode", "callback_mode_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_process", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_callback_mode_process", "get_callback_mode_process");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_method", PROPERTY_HINT_ENUM, "Deferred,Immediate"), "set_callback_mode_method", "get_callback_mode_method");
@@ -146,6 +146,7 @@ protected:
 		Animation::TrackType type = Animation::TrackType::TYPE_ANIMATION;
 		NodePath path;
 		ObjectID object_id;
+		int blend_idx = -1; // Index in track_map, used for the track weights.
 		real_t total_weight = 0.0;
 
 		TrackCache() = default;
@@ -154,6 +155,7 @@ protected:
 				setup_pass(p_other.setup_pass),
 				type(p_other.type),
 				object_id(p_other.object_id),
+				blend_idx(p_other.blend_idx),
 				total_weight(p_other.total_weight) {}
 
 		virtual ~TrackCache() {}
@@ -174,6 +176,15 @@ protected:
 		Quaternion rot;
 		Vector3 scale;
 
+		// Results of the last two updates, interpolated while the update rate is reduced by LOD.
+		bool lod_valid = false;
+		Vector3 lod_from_loc;
+		Quaternion lod_from_rot;
+		Vector3 lod_from_scale;
+		Vector3 lod_to_loc;
+		Quaternion lod_to_rot;
+		Vector3 lod_to_scale;
+
 		TrackCacheTransform(const TrackCacheTransform &p_other) :
 				TrackCache(p_other),
 #ifndef _3D_DISABLED
@@ -296,6 +307,13 @@ protected:
 
 	RootMotionCache root_motion_cache;
 	HashMap<Animation::TypeHash, TrackCache *> track_cache;
+	// Cached track of each track of the animations in the libraries, to avoid looking them up by hash while blending,
+	// and where their keys were last found.
+	struct AnimationTrackCaches {
+		LocalVector<TrackCache *> tracks;
+		LocalVector<Animation::TrackCursor> cursors;
+	};
+	HashMap<ObjectID, AnimationTrackCaches> animation_track_caches;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
 
@@ -305,6 +323,17 @@ protected:
 	void _clear_playing_caches();
 	void _init_root_motion_cache();
 	bool _update_caches();
+	_FORCE_INLINE_ AnimationTrackCaches *_get_animation_track_caches(const Ref<Animation> &p_animation) {
+		AnimationTrackCaches *track_caches = animation_track_caches.getptr(p_animation->get_instance_id());
+		return track_caches && track_caches->tracks.size() == (uint32_t)p_animation->get_track_count() ? track_caches : nullptr;
+	}
+	_FORCE_INLINE_ TrackCache *_get_track_cache(const Ref<Animation> &p_animation, int p_track, const AnimationTrackCaches *p_track_caches) const {
+		if (p_track_caches) {
+			return p_track_caches->tracks[p_track];
+		}
+		TrackCache *const *track = track_cache.getptr(p_animation->track_get_type_hash(p_track));
+		return track ? *track : nullptr;
+	}
 
 	/* ---- Blending processor ---- */
 	LocalVector<AnimationInstance> animation_instances;
@@ -312,6 +341,45 @@ protected:
 	int track_count = 0;
 	bool deterministic = false;
 
+	/* ---- Parallel blending ---- */
+	// Whether all cached tracks can be blended without touching other objects, so _blend_process() can run off the main thread.
+	bool blend_thread_safe = false;
+	bool parallel_blending = false;
+#ifndef _3D_DISABLED
+	// Skeleton3D::get_motion_scale() of the animated skeletons, read on the main thread for blends running on other threads.
+	HashMap<ObjectID, float> motion_scales;
+	bool motion_scales_valid = false;
+	void _update_motion_scales();
+#endif // _3D_DISABLED
+
+	struct ParallelBlend {
+		ObjectID mixer_id;
+		AnimationMixer *mixer = nullptr;
+		double delta = 0.0;
+	};
+	static LocalVector<ParallelBlend> parallel_blends;
+	static void _parallel_blend_task(void *p_userdata, uint32_t p_index);
+	static void _process_parallel_blends();
+	void _process_internal(double p_delta);
+	void _blend_process_deferred(double p_delta);
+	void _blend_apply_deferred();
+
+	/* ---- Level of detail ---- */
+	double lod_update_interval = 0.0;
+	real_t lod_distance = 0.0;
+	NodePath lod_visibility_notifier;
+	bool lod_interpolate = true;
+	bool lod_skip_secondary_tracks = false;
+	bool lod_reduced = false;
+	double lod_elapsed = 0.0;
+
+	void _update_lod();
+	bool _lod_process(double &r_delta);
+	void _lod_apply_interpolated(real_t p_weight);
+#ifndef _3D_DISABLED
+	bool _apply_transform(const TrackCacheTransform *p_track, const Vector3 &p_loc, const Quaternion &p_rot, const Vector3 &p_scale);
+#endif // _3D_DISABLED
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
 	Vector3 root_motion_position = Vector3(0, 0, 0);
@@ -432,6 +500,24 @@ public:
 	Quaternion get_root_motion_rotation_accumulator() const;
 	Vector3 get_root_motion_scale_accumulator() const;
 
+	/* ---- Level of detail ---- */
+	void set_lod_update_interval(double p_interval);
+	double get_lod_update_interval() const;
+
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+
+	void set_lod_interpolate(bool p_interpolate);
+	bool is_lod_interpolating() const;
+
+	void set_lod_skip_secondary_tracks(bool p_skip);
+	bool is_lod_skipping_secondary_tracks() const;
+
+	bool is_lod_reduced() const;
+
 	/* ---- Blending processor ---- */
 	void make_animation_instance(const StringName &p_name, const PlaybackInfo p_playback_info);
 	void clear_animation_instances();
@@ -30,6 +30,8 @@
 
 #include "tween.h"
 
+#include "core/config/engine.h"
+#include "core/variant/variant_internal.h"
 #include "scene/animation/easing_equations.h"
 #include "scene/main/node.h"
 #include "scene/resources/animation.h"
@@ -564,6 +566,101 @@ void PropertyTweener::start() {
 	}
 
 	delta_val = Animation::subtract_variant(final_val, initial_val);
+	_prepare_interpolation();
+	_cache_setter(target_instance);
+}
+
+void PropertyTweener::_prepare_interpolation() {
+	// Same endpoints as Tween::interpolate_variant(), computed once.
+	interp_final_val = Animation::add_variant(initial_val, delta_val);
+	typed_interpolation = false;
+	if (initial_val.get_type() != interp_final_val.get_type()) {
+		return;
+	}
+
+	switch (initial_val.get_type()) {
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR3:
+		case Variant::VECTOR4:
+		case Variant::COLOR: {
+			current_val = initial_val;
+			typed_interpolation = true;
+		} break;
+		default: {
+		} break;
+	}
+}
+
+void PropertyTweener::_interpolate_typed(double p_time) {
+	ERR_FAIL_INDEX(trans_type, Tween::TRANS_MAX);
+	ERR_FAIL_INDEX(ease_type, Tween::EASE_MAX);
+
+	const float weight = Tween::run_equation(trans_type, ease_type, p_time, 0.0, 1.0, duration);
+	switch (current_val.get_type()) {
+		case Variant::FLOAT: {
+			*VariantInternal::get_float(&current_val) = Math::lerp(*VariantInternal::get_float(&initial_val), *VariantInternal::get_float(&interp_final_val), (double)weight);
+		} break;
+		case Variant::VECTOR2: {
+			*VariantInternal::get_vector2(&current_val) = VariantInternal::get_vector2(&initial_val)->lerp(*VariantInternal::get_vector2(&interp_final_val), weight);
+		} break;
+		case Variant::VECTOR3: {
+			*VariantInternal::get_vector3(&current_val) = VariantInternal::get_vector3(&initial_val)->lerp(*VariantInternal::get_vector3(&interp_final_val), weight);
+		} break;
+		case Variant::VECTOR4: {
+			*VariantInternal::get_vector4(&current_val) = VariantInternal::get_vector4(&initial_val)->lerp(*VariantInternal::get_vector4(&interp_final_val), weight);
+		} break;
+		case Variant::COLOR: {
+			*VariantInternal::get_color(&current_val) = VariantInternal::get_color(&initial_val)->lerp(*VariantInternal::get_color(&interp_final_val), weight);
+		} break;
+		default: {
+		} break;
+	}
+}
+
+void PropertyTweener::_cache_setter(const Object *p_target) {
+	setter = nullptr;
+	setter_index = -1;
+
+	if (property.size() != 1) {
+		return;
+	}
+	// Extension classes may handle the property in their own setter first.
+	const StringName class_name = p_target->get_class_name();
+	const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+		return;
+	}
+#ifdef TOOLS_ENABLED
+	// Object::set() also marks the object as edited.
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return;
+	}
+#endif
+
+	const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(class_name, property[0]);
+	if (psg && psg->_setptr) {
+		setter = psg->_setptr;
+		setter_index = psg->index;
+	}
+}
+
+void PropertyTweener::_set_value(Object *p_target, const Variant &p_value) {
+	// Scripts have priority over native properties in Object::set(), so they must go through it.
+	if (!setter || p_target->get_script_instance()) {
+		p_target->set_indexed(property, p_value);
+		return;
+	}
+
+	Callable::CallError ce;
+	if (setter_index >= 0) {
+		Variant index = setter_index;
+		const Variant *args[2] = { &index, &p_value };
+		setter->call(p_target, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		setter->call(p_target, args, 1, ce);
+	}
 }
 
 bool PropertyTweener::step(double &r_delta) {
@@ -584,15 +681,14 @@ bool PropertyTweener::step(double &r_delta) {
 	} else if (do_continue_delayed && !Math::is_zero_approx(delay)) {
 		initial_val = target_instance->get_indexed(property);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
+		_prepare_interpolation();
 		do_continue_delayed = false;
 	}
 
-	Ref<Tween> tween = _get_tween();
-
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
 		if (custom_method.is_valid()) {
-			const Variant t = tween->interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
+			const Variant t = Tween::interpolate_variant(0.0, 1.0, time, duration, trans_type, ease_type);
 			const Variant *argptr = &t;
 
 			Variant result;
@@ -604,14 +700,17 @@ bool PropertyTweener::step(double &r_delta) {
 				ERR_FAIL_V_MSG(false, vformat("Wrong return type in PropertyTweener custom method. Expected float, got %s.", Variant::get_type_name(result.get_type())));
 			}
 
-			target_instance->set_indexed(property, Animation::interpolate_variant(initial_val, final_val, result));
+			_set_value(target_instance, Animation::interpolate_variant(initial_val, final_val, result));
+		} else if (typed_interpolation) {
+			_interpolate_typed(time);
+			_set_value(target_instance, current_val);
 		} else {
-			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+			_set_value(target_instance, Tween::interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
 		}
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		_set_value(target_instance, final_val);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SNAME("finished"));
@@ -778,12 +877,10 @@ bool MethodTweener::step(double &r_delta) {
 		return true;
 	}
 
-	Ref<Tween> tween = _get_tween();
-
 	Variant current_val;
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
-		current_val = tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type);
+		current_val = Tween::interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type);
 	} else {
 		current_val = final_val;
 	}
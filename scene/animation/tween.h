@@ -222,6 +222,15 @@ private:
 
 	Ref<RefCounted> ref_copy; // Makes sure that RefCounted objects are not freed too early.
 
+	// Float, vector and color values are interpolated in place instead of through Variant math.
+	Variant interp_final_val;
+	Variant current_val;
+	bool typed_interpolation = false;
+
+	// Setter of the native property, called directly instead of going through Object::set_indexed().
+	MethodBind *setter = nullptr;
+	int setter_index = -1;
+
 	double duration = 0;
 	Tween::TransitionType trans_type = Tween::TRANS_MAX; // This is set inside set_tween();
 	Tween::EaseType ease_type = Tween::EASE_MAX;
@@ -231,6 +240,11 @@ private:
 	bool do_continue = true;
 	bool do_continue_delayed = false;
 	bool relative = false;
+
+	void _prepare_interpolation();
+	void _interpolate_typed(double p_time);
+	void _cache_setter(const Object *p_target);
+	void _set_value(Object *p_target, const Variant &p_value);
 };
 
 class IntervalTweener : public Tweener {
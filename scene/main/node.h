@@ -383,6 +383,7 @@ public:
 		NOTIFICATION_DISABLED = 28,
 		NOTIFICATION_ENABLED = 29,
 		NOTIFICATION_RESET_PHYSICS_INTERPOLATION = 2001, // A GodotSpace Odyssey.
+		NOTIFICATION_SCENE_RECYCLED = 2002,
 		// Keep these linked to Node.
 		NOTIFICATION_WM_MOUSE_ENTER = 1002,
 		NOTIFICATION_WM_MOUSE_EXIT = 1003,
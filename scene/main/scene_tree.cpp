@@ -181,6 +181,11 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	{
+		MutexLock lock(batched_instances_mutex);
+		batching_instance_transforms++;
+	}
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -189,6 +194,26 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	// Nested flushes leave the transforms to the outermost one. Every transform set until then is batched,
+	// so the batch keeps them in order and none of them is overwritten by an older one.
+	MutexLock lock(batched_instances_mutex);
+	batching_instance_transforms--;
+	if (batching_instance_transforms == 0 && !batched_instances.is_empty()) {
+		RS::get_singleton()->instance_set_transforms(batched_instances, batched_instance_transforms);
+		batched_instances.clear();
+		batched_instance_transforms.clear();
+	}
+}
+
+void SceneTree::set_instance_transform(RID p_instance, const Transform3D &p_transform) {
+	MutexLock lock(batched_instances_mutex);
+	if (batching_instance_transforms > 0) {
+		batched_instances.push_back(p_instance);
+		batched_instance_transforms.push_back(p_transform);
+	} else {
+		RS::get_singleton()->instance_set_transform(p_instance, p_transform);
+	}
 }
 
 void SceneTree::_flush_ugc() {
@@ -619,28 +644,41 @@ void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
 	_THREAD_SAFE_METHOD_
 	// This methods works similarly to how SceneTreeTimers are handled.
-	List<Ref<Tween>>::Element *L = tweens.back();
+	// Tweens created while processing are appended, and processed starting next frame.
+	uint32_t count = tweens.size();
+	bool any_finished = false;
 
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
+	for (uint32_t i = 0; i < count; i++) {
+		// Stepping may append tweens, so the vector can't be referenced across the step.
+		Tween *tween = tweens[i].ptr();
 		// Don't process if paused or process mode doesn't match.
-		if (!E->get()->can_process(paused) || (p_physics == (E->get()->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
-			}
-			E = N;
+		if (!tween->can_process(paused) || (p_physics == (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
 			continue;
 		}
 
-		if (!E->get()->step(p_delta)) {
-			E->get()->clear();
-			tweens.erase(E);
+		if (!tween->step(p_delta)) {
+			tween->clear();
+			tweens[i].unref();
+			any_finished = true;
 		}
-		if (E == L) {
-			break;
+	}
+
+	if (!any_finished) {
+		return;
+	}
+
+	// Remove the released slots, keeping the processing order.
+	uint32_t to = 0;
+	for (uint32_t from = 0; from < tweens.size(); from++) {
+		if (tweens[from].is_null()) {
+			continue;
 		}
-		E = N;
+		if (to != from) {
+			tweens[to] = tweens[from];
+		}
+		to++;
 	}
+	tweens.resize(to);
 }
 
 void SceneTree::finalize() {
@@ -669,7 +707,9 @@ void SceneTree::finalize() {
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
-		tween->clear();
+		if (tween.is_valid()) {
+			tween->clear();
+		}
 	}
 	tweens.clear();
 }
@@ -1511,12 +1551,12 @@ Ref<Tween> SceneTree::create_tween() {
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	_THREAD_SAFE_METHOD_
 	TypedArray<Tween> ret;
-	ret.resize(tweens.size());
 
-	int i = 0;
 	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+		// Tweens that finished during this frame's processing are released already.
+		if (tween.is_valid()) {
+			ret.push_back(tween);
+		}
 	}
 
 	return ret;
@@ -195,7 +195,7 @@ private:
 	void _flush_scene_change();
 
 	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	LocalVector<Ref<Tween>> tweens;
 
 	///network///
 
@@ -237,6 +237,12 @@ private:
 
 	SelfList<Node>::List xform_change_list;
 
+	// Instance transforms set while flushing transform notifications, sent to the RenderingServer at once.
+	Mutex batched_instances_mutex;
+	int batching_instance_transforms = 0;
+	Vector<RID> batched_instances;
+	Vector<Transform3D> batched_instance_transforms;
+
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
 #endif
@@ -312,6 +318,7 @@ public:
 	}
 
 	void flush_transform_notifications();
+	void set_instance_transform(RID p_instance, const Transform3D &p_transform);
 
 	virtual void initialize() override;
 
@@ -1116,7 +1116,7 @@ Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_posit
 	return OK;
 }
 
-Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, ERR_INVALID_PARAMETER);
@@ -1124,7 +1124,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 	PositionTrack *tt = static_cast<PositionTrack *>(t);
 
 	if (tt->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(tt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1133,7 +1133,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, p_backward);
+	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1196,7 +1196,7 @@ Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_ro
 	return OK;
 }
 
-Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward) const {
+Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, ERR_INVALID_PARAMETER);
@@ -1204,7 +1204,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 	RotationTrack *rt = static_cast<RotationTrack *>(t);
 
 	if (rt->compressed_track >= 0) {
-		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation)) {
+		if (_rotation_interpolate_compressed(rt->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1213,7 +1213,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 
 	bool ok = false;
 
-	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, p_backward);
+	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1276,7 +1276,7 @@ Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) c
 	return OK;
 }
 
-Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, ERR_INVALID_PARAMETER);
@@ -1284,7 +1284,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 	ScaleTrack *st = static_cast<ScaleTrack *>(t);
 
 	if (st->compressed_track >= 0) {
-		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation)) {
+		if (_pos_scale_interpolate_compressed(st->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1293,7 +1293,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, p_backward);
+	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1356,7 +1356,7 @@ Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blen
 	return OK;
 }
 
-Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward) const {
+Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward, TrackCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, ERR_INVALID_PARAMETER);
@@ -1364,7 +1364,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 	BlendShapeTrack *bst = static_cast<BlendShapeTrack *>(t);
 
 	if (bst->compressed_track >= 0) {
-		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation)) {
+		if (_blend_shape_interpolate_compressed(bst->compressed_track, p_time, *r_interpolation, r_cursor)) {
 			return OK;
 		} else {
 			return ERR_UNAVAILABLE;
@@ -1373,7 +1373,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 
 	bool ok = false;
 
-	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, p_backward);
+	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -2332,12 +2332,26 @@ void Animation::track_set_key_transition(int p_track, int p_key_idx, real_t p_tr
 }
 
 template <typename K>
-int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, bool p_limit) const {
+int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, bool p_limit, int p_hint) const {
 	int len = p_keys.size();
 	if (len == 0) {
 		return -2;
 	}
 
+	const K *keys = &p_keys[0];
+
+	if (!p_backward && !p_limit && p_hint >= 0 && p_hint < len) {
+		// During sequential playback, the key is usually the last one found or the one after it.
+		int end = MIN(p_hint + 2, len);
+		for (int i = p_hint; i < end; i++) {
+			bool after_key = keys[i].time <= p_time || Math::is_equal_approx(p_time, (double)keys[i].time);
+			bool before_next = i + 1 == len || (p_time < keys[i + 1].time && !Math::is_equal_approx(p_time, (double)keys[i + 1].time));
+			if (after_key && before_next) {
+				return i;
+			}
+		}
+	}
+
 	int low = 0;
 	int high = len - 1;
 	int middle = 0;
@@ -2348,8 +2362,6 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, bo
 	}
 #endif
 
-	const K *keys = &p_keys[0];
-
 	while (low <= high) {
 		middle = (low + high) / 2;
 
@@ -2452,8 +2464,8 @@ Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, cons
 }
 
 template <typename T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward, TrackCursor *r_cursor) const {
+	int len = _find(p_keys, length, false, false, p_keys.size() - 1) + 1; // try to find last key (there may be more past the end)
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -2470,7 +2482,10 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time, p_backward);
+	int idx = _find(p_keys, p_time, p_backward, false, r_cursor ? r_cursor->key : -1);
+	if (r_cursor) {
+		r_cursor->key = idx;
+	}
 
 	ERR_FAIL_COND_V(idx == -2, T());
 	int maxi = len - 1;
@@ -5028,13 +5043,13 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
-bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
+bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret, TrackCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5052,13 +5067,13 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	return true;
 }
 
-bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const {
+bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret, TrackCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5075,13 +5090,13 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 
 	return true;
 }
-bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const {
+bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret, TrackCursor *r_cursor) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, r_cursor)) {
 		return false; //some sort of problem
 	}
 
@@ -5100,7 +5115,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 }
 
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, TrackCursor *r_cursor) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5111,11 +5126,15 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double frame_to_sec = 1.0 / double(compression.fps);
 
 	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	if (r_cursor && r_cursor->page >= 0 && (uint32_t)r_cursor->page < compression.pages.size() && compression.pages[r_cursor->page].time_offset <= p_time && ((uint32_t)r_cursor->page + 1 == compression.pages.size() || compression.pages[r_cursor->page + 1].time_offset > p_time)) {
+		page_index = r_cursor->page; // Still in the page of the last sample.
+	} else {
+		for (uint32_t i = 0; i < compression.pages.size(); i++) {
+			if (compression.pages[i].time_offset > p_time) {
+				break;
+			}
+			page_index = i;
 		}
-		page_index = i;
 	}
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
@@ -5128,10 +5147,18 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
 
 	int32_t packet_idx = 0;
-	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
-	uint32_t base_frame = time_keys[0];
+	// Resume from the packet of the last sample if it is not past the requested time. Keys are counted from the start of the page, so not when they are requested.
+	if (r_cursor && !key_index && r_cursor->page == page_index && r_cursor->packet > 0 && (uint32_t)r_cursor->packet < time_key_count && double(time_keys[r_cursor->packet * 2 + 0]) * frame_to_sec + page_base_time <= p_time) {
+		packet_idx = r_cursor->packet;
+	}
+	double packet_time = double(time_keys[packet_idx * 2 + 0]) * frame_to_sec + page_base_time;
+	uint32_t base_frame = time_keys[packet_idx * 2 + 0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
+	if (r_cursor) {
+		r_cursor->page = page_index;
+	}
+
+	for (uint32_t i = packet_idx + 1; i < time_key_count; i++) {
 		uint32_t f = time_keys[i * 2 + 0];
 		double frame_time = double(f) * frame_to_sec + page_base_time;
 
@@ -5148,6 +5175,10 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		base_frame = f;
 	}
 
+	if (r_cursor) {
+		r_cursor->packet = packet_idx;
+	}
+
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
 
 	uint16_t time_key_data = time_keys[packet_idx * 2 + 1];
@@ -30,38 +30,55 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/project_settings.h"
 #include "scene/resources/bit_map.h"
 
-Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
-	alpha_cache.unref();
-
-	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
+Ref<FileAccess> CompressedTexture2D::_open_file(const String &p_path, int &r_width, int &r_height, uint32_t &r_data_format, int &r_mipmap_limit, Error &r_error) {
+	r_error = ERR_FILE_CORRUPT;
 
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
-	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_CANT_OPEN, vformat("Unable to open file: %s.", p_path));
+	if (f.is_null()) {
+		r_error = ERR_CANT_OPEN;
+		ERR_FAIL_V_MSG(Ref<FileAccess>(), vformat("Unable to open file: %s.", p_path));
+	}
 
 	uint8_t header[4];
 	f->get_buffer(header, 4);
 	if (header[0] != 'G' || header[1] != 'S' || header[2] != 'T' || header[3] != '2') {
-		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Compressed texture file is corrupt (Bad header).");
+		ERR_FAIL_V_MSG(Ref<FileAccess>(), "Compressed texture file is corrupt (Bad header).");
 	}
 
 	uint32_t version = f->get_32();
 
 	if (version > FORMAT_VERSION) {
-		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Compressed texture file is too new.");
+		ERR_FAIL_V_MSG(Ref<FileAccess>(), "Compressed texture file is too new.");
 	}
 	r_width = f->get_32();
 	r_height = f->get_32();
-	uint32_t df = f->get_32(); //data format
+	r_data_format = f->get_32();
 
-	//skip reserved
-	mipmap_limit = int(f->get_32());
+	r_mipmap_limit = int(f->get_32());
 	//reserved
 	f->get_32();
 	f->get_32();
 	f->get_32();
 
+	r_error = OK;
+	return f;
+}
+
+Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
+	alpha_cache.unref();
+
+	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
+
+	uint32_t df; //data format
+	Error err;
+	Ref<FileAccess> f = _open_file(p_path, r_width, r_height, df, mipmap_limit, err);
+	if (f.is_null()) {
+		return err;
+	}
+
 #ifdef TOOLS_ENABLED
 
 	r_request_3d = request_3d_callback && df & FORMAT_BIT_DETECT_3D;
@@ -125,6 +142,192 @@ Image::Format CompressedTexture2D::get_format() const {
 	return format;
 }
 
+Mutex CompressedTexture2D::stream_mutex;
+SelfList<CompressedTexture2D>::List CompressedTexture2D::stream_resident_list;
+uint64_t CompressedTexture2D::stream_resident_memory = 0;
+uint64_t CompressedTexture2D::stream_last_request_id = 0;
+HashMap<uint64_t, WorkerThreadPool::TaskID> CompressedTexture2D::stream_tasks;
+
+bool CompressedTexture2D::_is_streaming_enabled() {
+	return GLOBAL_GET("rendering/textures/streaming/enabled");
+}
+
+// Reads the mip chain of a .ctex file, skipping mips larger than the size limit.
+Ref<Image> CompressedTexture2D::_load_streamed_image(const String &p_path, int p_size_limit) {
+	int width, height, mipmap_limit;
+	uint32_t data_format;
+	Error err;
+	Ref<FileAccess> f = _open_file(p_path, width, height, data_format, mipmap_limit, err);
+	if (f.is_null()) {
+		return Ref<Image>();
+	}
+	return load_image_from_file(f, p_size_limit);
+}
+
+void CompressedTexture2D::_stream_release_memory() {
+	MutexLock lock(stream_mutex);
+	if (stream_list_item.in_list()) {
+		stream_resident_list.remove(&stream_list_item);
+	}
+	stream_resident_memory -= stream_extra_memory;
+	stream_extra_memory = 0;
+}
+
+void CompressedTexture2D::_stream_start_load(int p_size_limit) {
+	// The task only gets a copy of what it needs, so the texture never waits for it
+	// and can be reloaded or freed meanwhile. Outdated results are discarded in _stream_finished().
+	StreamLoad *load = memnew(StreamLoad);
+	load->texture_id = get_instance_id();
+	load->path = path_to_file;
+	load->size_limit = p_size_limit;
+
+	MutexLock lock(stream_mutex);
+	load->request_id = ++stream_last_request_id;
+	stream_request_id = load->request_id;
+	stream_pending_size_limit = p_size_limit;
+	stream_tasks[load->request_id] = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_stream_load_task, load, false, "Stream texture mipmaps");
+}
+
+void CompressedTexture2D::_stream_load_task(void *p_userdata) {
+	StreamLoad *load = static_cast<StreamLoad *>(p_userdata);
+	Ref<Image> image = _load_streamed_image(load->path, load->size_limit);
+	callable_mp_static(&CompressedTexture2D::_stream_finished).call_deferred(load->texture_id, load->request_id, image, load->size_limit);
+	memdelete(load);
+}
+
+void CompressedTexture2D::_stream_finished(ObjectID p_id, uint64_t p_request_id, const Ref<Image> &p_image, int p_size_limit) {
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	{
+		MutexLock lock(stream_mutex);
+		HashMap<uint64_t, WorkerThreadPool::TaskID>::Iterator E = stream_tasks.find(p_request_id);
+		if (E) {
+			task_id = E->value;
+			stream_tasks.remove(E);
+		}
+	}
+	if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+		// The task is done at this point, this only releases it.
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
+
+	CompressedTexture2D *ctex = Object::cast_to<CompressedTexture2D>(ObjectDB::get_instance(p_id));
+	if (!ctex || ctex->stream_request_id != p_request_id) {
+		return; // Freed, reloaded or superseded by another request while loading.
+	}
+	ctex->_stream_apply(p_image, p_size_limit);
+}
+
+void CompressedTexture2D::_stream_apply(const Ref<Image> &p_image, int p_size_limit) {
+	stream_request_id = 0;
+	stream_pending_size_limit = -1;
+	ERR_FAIL_COND_MSG(p_image.is_null() || p_image->is_empty(), vformat("Unable to stream the mipmaps of: %s.", path_to_file));
+
+	RID new_texture = RS::get_singleton()->texture_2d_create(p_image);
+	RS::get_singleton()->texture_replace(texture, new_texture);
+	RS::get_singleton()->texture_set_size_override(texture, w, h);
+	alpha_cache.unref();
+	stream_size_limit = p_size_limit;
+
+	if (p_size_limit == stream_initial_size_limit) {
+		// Evicted, the memory was already released.
+		return;
+	}
+
+	uint64_t memory = p_image->get_data().size();
+	uint64_t extra_memory = memory > stream_initial_memory ? memory - stream_initial_memory : 0;
+	{
+		MutexLock lock(stream_mutex);
+		stream_resident_memory = stream_resident_memory - stream_extra_memory + extra_memory;
+		stream_extra_memory = extra_memory;
+		if (!stream_list_item.in_list()) {
+			stream_resident_list.add_last(&stream_list_item);
+		}
+	}
+	_stream_enforce_budget(this);
+}
+
+void CompressedTexture2D::_stream_enforce_budget(const CompressedTexture2D *p_keep) {
+	uint64_t budget = uint64_t(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024;
+	while (true) {
+		CompressedTexture2D *victim = nullptr;
+		{
+			MutexLock lock(stream_mutex);
+			if (stream_resident_memory <= budget) {
+				return;
+			}
+			for (SelfList<CompressedTexture2D> *E = stream_resident_list.first(); E; E = E->next()) {
+				if (E->self() != p_keep) {
+					victim = E->self();
+					break;
+				}
+			}
+		}
+		if (!victim) {
+			return;
+		}
+		// Releases the victim's memory right away, its smaller mips are loaded in the background.
+		victim->evict_streamed_mips();
+	}
+}
+
+void CompressedTexture2D::request_mip_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "Texture mipmaps can only be requested from the main thread.");
+	if (!streamable) {
+		return;
+	}
+
+	int size_limit = 0;
+	if (p_size > 0 && p_size < MAX(w, h)) {
+		size_limit = next_power_of_2(p_size);
+		if (size_limit >= MAX(w, h)) {
+			size_limit = 0;
+		}
+	}
+
+	{
+		// Mark as most recently used.
+		MutexLock lock(stream_mutex);
+		if (stream_list_item.in_list()) {
+			stream_resident_list.remove(&stream_list_item);
+			stream_resident_list.add_last(&stream_list_item);
+		}
+	}
+
+	// A size limit of 0 means the whole chain, which covers any other limit.
+	int covered_size_limit = stream_pending_size_limit != -1 ? stream_pending_size_limit : stream_size_limit;
+	if (covered_size_limit == 0 || (size_limit != 0 && size_limit <= covered_size_limit)) {
+		return;
+	}
+
+	// Any smaller load still in progress is superseded by this one.
+	_stream_start_load(size_limit);
+}
+
+void CompressedTexture2D::evict_streamed_mips() {
+	if (!streamable) {
+		return;
+	}
+
+	_stream_release_memory();
+	if (stream_pending_size_limit == stream_initial_size_limit) {
+		return; // Already being evicted.
+	}
+	if (stream_size_limit == stream_initial_size_limit) {
+		// Only cancel the load in progress, if any.
+		stream_request_id = 0;
+		stream_pending_size_limit = -1;
+		return;
+	}
+
+	// There is no CPU copy of the resident mips, so the smaller ones are read from the file again.
+	_stream_start_load(stream_initial_size_limit);
+}
+
+bool CompressedTexture2D::is_fully_resident() const {
+	return !streamable || stream_size_limit == 0;
+}
+
 Error CompressedTexture2D::load(const String &p_path) {
 	int lw, lh;
 	Ref<Image> image;
@@ -135,11 +338,27 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	// Any streaming in progress refers to the previous file, its result is discarded.
+	_stream_release_memory();
+	stream_request_id = 0;
+	stream_pending_size_limit = -1;
+
+	int size_limit = 0;
+	if (_is_streaming_enabled()) {
+		size_limit = MAX(int(GLOBAL_GET("rendering/textures/streaming/initial_size_limit")), 0);
+	}
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, size_limit);
 	if (err) {
 		return err;
 	}
 
+	// Only textures imported with streaming enabled honor the size limit.
+	streamable = size_limit > 0 && (image->get_width() < lw || image->get_height() < lh);
+	stream_initial_size_limit = streamable ? size_limit : 0;
+	stream_size_limit = stream_initial_size_limit;
+	stream_initial_memory = image->get_data().size();
+
 	if (texture.is_valid()) {
 		RID new_texture = RS::get_singleton()->texture_2d_create(image);
 		RS::get_singleton()->texture_replace(texture, new_texture);
@@ -211,10 +430,24 @@ RID CompressedTexture2D::get_rid() const {
 	return texture;
 }
 
+void CompressedTexture2D::_stream_request_draw_size(const Size2 &p_draw_size, const Size2 &p_src_size) const {
+	if (!streamable || stream_size_limit == 0 || !Thread::is_main_thread()) {
+		return;
+	}
+	// The mips needed to draw the source region at this size, in canvas units. Canvas transforms are not known here.
+	Size2 scale = (p_draw_size / p_src_size.max(Size2(1, 1))).abs();
+	int size = int(Math::ceil(MAX(w * scale.x, h * scale.y)));
+	if (size > stream_size_limit) {
+		// Drawing doesn't change the texture from the user's point of view, only which of its mips are resident.
+		const_cast<CompressedTexture2D *>(this)->request_mip_size(size);
+	}
+}
+
 void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Color &p_modulate, bool p_transpose) const {
 	if ((w | h) == 0) {
 		return;
 	}
+	_stream_request_draw_size(Size2(w, h), Size2(w, h));
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, Rect2(p_pos, Size2(w, h)), texture, false, p_modulate, p_transpose);
 }
 
@@ -222,6 +455,8 @@ void CompressedTexture2D::draw_rect(RID p_canvas_item, const Rect2 &p_rect, bool
 	if ((w | h) == 0) {
 		return;
 	}
+	// Tiled textures are drawn at their own size.
+	_stream_request_draw_size(p_tile ? Size2(w, h) : p_rect.size, Size2(w, h));
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, p_rect, texture, p_tile, p_modulate, p_transpose);
 }
 
@@ -229,6 +464,7 @@ void CompressedTexture2D::draw_rect_region(RID p_canvas_item, const Rect2 &p_rec
 	if ((w | h) == 0) {
 		return;
 	}
+	_stream_request_draw_size(p_rect.size, p_src_rect.size);
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, p_rect, texture, p_src_rect, p_modulate, p_transpose, p_clip_uv);
 }
 
@@ -389,7 +625,8 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			// When mips were skipped due to the size limit, the first loaded mip is the base level.
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
@@ -426,13 +663,15 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			// Mips are stored sequentially, so skip the larger ones and read the rest of the chain.
+			if (ofs) {
+				f->seek(f->get_position() + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -454,12 +693,19 @@ void CompressedTexture2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load", "path"), &CompressedTexture2D::load);
 	ClassDB::bind_method(D_METHOD("get_load_path"), &CompressedTexture2D::get_load_path);
 
+	ClassDB::bind_method(D_METHOD("request_mip_size", "size"), &CompressedTexture2D::request_mip_size);
+	ClassDB::bind_method(D_METHOD("evict_streamed_mips"), &CompressedTexture2D::evict_streamed_mips);
+	ClassDB::bind_method(D_METHOD("is_fully_resident"), &CompressedTexture2D::is_fully_resident);
+
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "load_path", PROPERTY_HINT_FILE, "*.ctex"), "load", "get_load_path");
 }
 
-CompressedTexture2D::CompressedTexture2D() {}
+CompressedTexture2D::CompressedTexture2D() :
+		stream_list_item(this) {
+}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	_stream_release_memory();
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
@@ -31,6 +31,9 @@
 #ifndef COMPRESSED_TEXTURE_H
 #define COMPRESSED_TEXTURE_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/self_list.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -67,6 +70,41 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Mip streaming (see `rendering/textures/streaming/*`). Only the mips up to
+	// `stream_size_limit` are resident, others are loaded on request.
+	bool streamable = false;
+	int stream_initial_size_limit = 0;
+	int stream_size_limit = 0; // 0 when the whole mip chain is resident.
+	uint64_t stream_initial_memory = 0;
+	int stream_pending_size_limit = -1; // Size limit being loaded in the background, -1 if none.
+	uint64_t stream_request_id = 0; // Load in progress whose result is applied, 0 if none.
+	uint64_t stream_extra_memory = 0; // Memory used above the initial streaming size limit.
+	SelfList<CompressedTexture2D> stream_list_item;
+
+	struct StreamLoad {
+		ObjectID texture_id;
+		uint64_t request_id = 0;
+		String path;
+		int size_limit = 0;
+	};
+
+	static Mutex stream_mutex;
+	static SelfList<CompressedTexture2D>::List stream_resident_list; // Streamed in textures, least recently requested first.
+	static uint64_t stream_resident_memory;
+	static uint64_t stream_last_request_id;
+	static HashMap<uint64_t, WorkerThreadPool::TaskID> stream_tasks; // Released once their result reaches the main thread.
+
+	static bool _is_streaming_enabled();
+	static Ref<Image> _load_streamed_image(const String &p_path, int p_size_limit);
+	static void _stream_load_task(void *p_userdata);
+	static void _stream_finished(ObjectID p_id, uint64_t p_request_id, const Ref<Image> &p_image, int p_size_limit);
+	static void _stream_enforce_budget(const CompressedTexture2D *p_keep);
+	void _stream_start_load(int p_size_limit);
+	void _stream_apply(const Ref<Image> &p_image, int p_size_limit);
+	void _stream_release_memory();
+	void _stream_request_draw_size(const Size2 &p_draw_size, const Size2 &p_src_size) const;
+
+	static Ref<FileAccess> _open_file(const String &p_path, int &r_width, int &r_height, uint32_t &r_data_format, int &r_mipmap_limit, Error &r_error);
 	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
 	virtual void reload_from_file() override;
 
@@ -92,6 +130,10 @@ public:
 	Error load(const String &p_path);
 	String get_load_path() const;
 
+	void request_mip_size(int p_size);
+	void evict_streamed_mips();
+	bool is_fully_resident() const;
+
 	int get_width() const override;
 	int get_height() const override;
 	virtual RID get_rid() const override;
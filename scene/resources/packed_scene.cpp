@@ -125,6 +125,63 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_valid) {
+		return instantiation_plan.ptr();
+	}
+
+	instantiation_plan.clear();
+	instantiation_plan.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan &plan = instantiation_plan[i];
+
+		if (n.instance >= 0 || n.type == TYPE_INSTANTIATED || (i == 0 && base_scene_idx >= 0)) {
+			continue; // Not created from a class, see instantiate().
+		}
+		ERR_CONTINUE(n.type < 0 || n.type >= names.size());
+		plan.type = names[n.type];
+
+		ClassDB::APIType api = ClassDB::get_api_type(plan.type);
+		if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+			// Extension classes can be unloaded, taking their setters with them.
+			plan.type = StringName();
+			continue;
+		}
+
+		plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			plan.setters[j] = nullptr;
+
+			const NodeData::Property &prop = n.properties[j];
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || prop.value < 0 || prop.value >= variants.size()) {
+				continue;
+			}
+
+			// Objects, arrays and dictionaries may hold resources local to scene, which need to be set up first.
+			Variant::Type value_type = variants[prop.value].get_type();
+			if (value_type == Variant::OBJECT || value_type == Variant::ARRAY || value_type == Variant::DICTIONARY) {
+				continue;
+			}
+
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(plan.type, names[prop.name]);
+			if (psg && psg->_setptr) {
+				plan.setters[j] = psg;
+			}
+		}
+	}
+
+	instantiation_plan_valid = true;
+	return instantiation_plan.ptr();
+}
+
+void SceneState::_invalidate_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_valid = false;
+	instantiation_plan.clear();
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -166,6 +223,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The editor needs Object::set() to track edited state.
+	const InstantiationPlan *plan = p_edit_state == GEN_EDIT_STATE_DISABLED ? _get_instantiation_plan() : nullptr;
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -308,11 +368,35 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				Dictionary missing_resource_properties;
 				HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_sub_scene; // Record the mappings in the sub-scene.
 
+				// The node may be a placeholder if its class could not be created.
+				const ClassDB::PropertySetGet *const *setters = nullptr;
+				if (plan && plan[i].setters.size() == uint32_t(nprop_count) && node->get_class_name() == plan[i].type) {
+					setters = plan[i].setters.ptr();
+				}
+
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 
 					ERR_FAIL_INDEX_V(nprops[j].value, prop_count, nullptr);
 
+					if (setters && setters[j] && !node->get_script_instance()) {
+						// Same as what Object::set() ends up doing, without looking up the setter.
+						const ClassDB::PropertySetGet *psg = setters[j];
+						Callable::CallError ce;
+						if (psg->index >= 0) {
+							Variant index = psg->index;
+							const Variant *args[2] = { &index, &props[nprops[j].value] };
+							psg->_setptr->call(node, args, 2, ce);
+						} else {
+							const Variant *args[1] = { &props[nprops[j].value] };
+							psg->_setptr->call(node, args, 1, ce);
+						}
+						if (ce.error == Callable::CallError::CALL_OK) {
+							continue;
+						}
+						// Let Object::set() handle the failed call, as it would have without the plan.
+					}
+
 					if (nprops[j].name & FLAG_PATH_PROPERTY_IS_NODE) {
 						uint32_t name_idx = nprops[j].name & (FLAG_PATH_PROPERTY_IS_NODE - 1);
 						ERR_FAIL_UNSIGNED_INDEX_V(name_idx, (uint32_t)sname_count, nullptr);
@@ -1175,6 +1259,8 @@ Error SceneState::pack(Node *p_scene) {
 		variants.write[idx] = E.key;
 	}
 
+	_invalidate_instantiation_plan();
+
 	node_paths.resize(nodepath_map.size());
 	for (const KeyValue<Node *, int> &E : nodepath_map) {
 		node_paths.write[E.value] = scene->get_path_to(E.key);
@@ -1199,6 +1285,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_invalidate_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1236,6 +1323,7 @@ Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
 		editable_instances.append(E);
 	}
 	base_scene_idx = p_scene_state->base_scene_idx;
+	_invalidate_instantiation_plan();
 
 	return OK;
 }
@@ -1261,6 +1349,7 @@ void SceneState::update_instance_resource(String p_path, Ref<PackedScene> p_pack
 				Ref<PackedScene> original_packed_scene = variants[instance_id];
 				if (original_packed_scene.is_valid()) {
 					if (original_packed_scene->get_path() == p_path) {
+						_invalidate_instantiation_plan();
 						variants.remove_at(instance_id);
 						variants.insert(instance_id, p_packed_scene);
 					}
@@ -1409,6 +1498,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_invalidate_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1867,11 +1958,13 @@ Vector<NodePath> SceneState::get_editable_instances() const {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_invalidate_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
 
 int SceneState::add_value(const Variant &p_value) {
+	_invalidate_instantiation_plan();
 	variants.push_back(p_value);
 	return variants.size() - 1;
 }
@@ -1890,6 +1983,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_invalidate_instantiation_plan();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1906,17 +2000,20 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_invalidate_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_group, names.size());
+	_invalidate_instantiation_plan();
 	nodes.write[p_node].groups.push_back(p_group);
 }
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_invalidate_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -1947,6 +2044,7 @@ bool SceneState::remove_group_references(const StringName &p_name) {
 	for (NodeData &node : nodes) {
 		for (const int &group : node.groups) {
 			if (names[group] == p_name) {
+				_invalidate_instantiation_plan();
 				node.groups.erase(group);
 				edited = true;
 				break;
@@ -1961,6 +2059,8 @@ bool SceneState::rename_group_references(const StringName &p_old_name, const Str
 	for (const NodeData &node : nodes) {
 		for (const int &group : node.groups) {
 			if (names[group] == p_old_name) {
+				// Names are shared, so this may rename properties too.
+				_invalidate_instantiation_plan();
 				names.write[group] = p_new_name;
 				edited = true;
 				break;
@@ -89,6 +89,21 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Property setters resolved ahead of time for the nodes this scene creates from a class,
+	// so instantiate() can call them directly instead of looking them up through Object::set().
+	// Built from names, variants, nodes and base_scene_idx: whatever changes them must invalidate it.
+	struct InstantiationPlan {
+		StringName type; // Empty if the node is not created from a class.
+		LocalVector<const ClassDB::PropertySetGet *> setters; // One per property, nullptr if Object::set() must be used.
+	};
+
+	mutable LocalVector<InstantiationPlan> instantiation_plan;
+	mutable bool instantiation_plan_valid = false;
+	mutable Mutex instantiation_plan_mutex;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _invalidate_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
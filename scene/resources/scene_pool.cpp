@@ -0,0 +1,301 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+#include "core/templates/hash_set.h"
+
+void ScenePool::_collect_nodes(Node *p_node, LocalVector<Node *> &r_nodes) {
+	r_nodes.push_back(p_node);
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_collect_nodes(p_node->get_child(i), r_nodes);
+	}
+}
+
+void ScenePool::_record_scene_state(const LocalVector<Node *> &p_nodes) {
+	HashMap<Node *, int> positions;
+	scene_state.resize(p_nodes.size());
+	for (uint32_t i = 0; i < p_nodes.size(); i++) {
+		Node *node = p_nodes[i];
+		positions.insert(node, i);
+
+		NodeState &state = scene_state[i];
+		state.parent = i > 0 ? positions[node->get_parent()] : -1;
+		state.index = i > 0 ? node->get_index() : 0;
+		state.name = node->get_name();
+		state.properties.clear();
+
+		List<PropertyInfo> property_list;
+		node->get_property_list(&property_list);
+		for (const PropertyInfo &E : property_list) {
+			if (!(E.usage & PROPERTY_USAGE_STORAGE) || (E.usage & PROPERTY_USAGE_READ_ONLY)) {
+				continue;
+			}
+			Variant value = node->get(E.name);
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				value = value.duplicate(true); // Don't share them with the node, which may modify them in place.
+			}
+			state.properties.push_back(Pair<StringName, Variant>(E.name, value));
+		}
+	}
+}
+
+bool ScenePool::_restore_state(Node *p_root, const InstanceState &p_state) const {
+	// Nodes that were freed or moved elsewhere can't be restored.
+	LocalVector<Node *> nodes;
+	nodes.resize(p_state.nodes.size());
+	HashSet<ObjectID> recorded_ids;
+	for (uint32_t i = 0; i < p_state.nodes.size(); i++) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(p_state.nodes[i]));
+		if (!node) {
+			return false;
+		}
+		// Parents are recorded before their children.
+		Node *parent = scene_state[i].parent >= 0 ? nodes[scene_state[i].parent] : nullptr;
+		if (node->get_parent() != parent) {
+			return false;
+		}
+		nodes[i] = node;
+		recorded_ids.insert(p_state.nodes[i]);
+	}
+	ERR_FAIL_COND_V(nodes.is_empty() || nodes[0] != p_root, false);
+
+	// Free the nodes added after the scene was instantiated.
+	// They may be the ones releasing the instance, so don't free them while their code runs.
+	for (Node *node : nodes) {
+		for (int i = node->get_child_count() - 1; i >= 0; i--) {
+			Node *child = node->get_child(i);
+			if (!recorded_ids.has(child->get_instance_id())) {
+				node->remove_child(child);
+				child->queue_free();
+			}
+		}
+	}
+
+	// Siblings are recorded in order, so moving each one to its index restores the order of all of them.
+	uint32_t override_index = 0;
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		Node *node = nodes[i];
+		const NodeState &state = scene_state[i];
+		if (node->get_name() != state.name) {
+			node->set_name(state.name);
+		}
+		if (node != p_root && node->get_index() != state.index) {
+			node->get_parent()->move_child(node, state.index);
+		}
+
+		for (uint32_t j = 0; j < state.properties.size(); j++) {
+			const Variant *value = &state.properties[j].second;
+			if (override_index < p_state.overrides.size() && p_state.overrides[override_index].node == i && p_state.overrides[override_index].property == j) {
+				value = &p_state.overrides[override_index].value;
+				override_index++;
+			}
+			const StringName &property = state.properties[j].first;
+			if (node->get(property) == *value) {
+				continue;
+			}
+			if (value->get_type() == Variant::ARRAY || value->get_type() == Variant::DICTIONARY) {
+				node->set(property, value->duplicate(true));
+			} else {
+				node->set(property, *value);
+			}
+		}
+	}
+
+	return true;
+}
+
+void ScenePool::_prune_instance_states() {
+	// Instances freed instead of being released leave their state behind.
+	LocalVector<ObjectID> freed;
+	for (const KeyValue<ObjectID, InstanceState> &E : instance_states) {
+		if (!ObjectDB::get_instance(E.key)) {
+			freed.push_back(E.key);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		instance_states.erase(id);
+	}
+	instance_states_prune_size = MAX(64u, instance_states.size() * 2);
+}
+
+Node *ScenePool::_create_instance() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "A scene must be set before using the pool.");
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	LocalVector<Node *> nodes;
+	_collect_nodes(node, nodes);
+	if (scene_state.is_empty()) {
+		_record_scene_state(nodes);
+	} else if (nodes.size() != scene_state.size()) {
+		memdelete(node);
+		ERR_FAIL_V_MSG(nullptr, "The scene doesn't instantiate the same nodes every time, so it can't be pooled.");
+	}
+
+	if (instance_states.size() >= instance_states_prune_size) {
+		_prune_instance_states();
+	}
+
+	// Only keep the values that differ from the recorded ones.
+	InstanceState &state = instance_states[node->get_instance_id()];
+	state.nodes.resize(nodes.size());
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		state.nodes[i] = nodes[i]->get_instance_id();
+
+		const LocalVector<Pair<StringName, Variant>> &properties = scene_state[i].properties;
+		for (uint32_t j = 0; j < properties.size(); j++) {
+			Variant value = nodes[i]->get(properties[j].first);
+			if (value == properties[j].second) {
+				continue;
+			}
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				value = value.duplicate(true);
+			}
+			PropertyOverride property_override;
+			property_override.node = i;
+			property_override.property = j;
+			property_override.value = value;
+			state.overrides.push_back(property_override);
+		}
+	}
+	return node;
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	instance_states.clear();
+	scene_state.clear();
+	scene = p_scene;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+	while (max_size > 0 && available.size() > uint32_t(max_size)) {
+		Node *node = available[available.size() - 1];
+		available.remove_at(available.size() - 1);
+		instance_states.erase(node->get_instance_id());
+		memdelete(node);
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+Node *ScenePool::acquire() {
+	if (available.is_empty()) {
+		return _create_instance();
+	}
+
+	Node *node = available[available.size() - 1];
+	available.remove_at(available.size() - 1);
+	// Instances created by prefill() are new, only notify the reused ones.
+	const InstanceState *state = instance_states.getptr(node->get_instance_id());
+	if (state && state->recycled) {
+		node->propagate_notification(Node::NOTIFICATION_SCENE_RECYCLED);
+	}
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	InstanceState *state = instance_states.getptr(p_node->get_instance_id());
+	ERR_FAIL_NULL_MSG(state, "The node was not acquired from this pool.");
+	ERR_FAIL_COND_MSG(available.find(p_node) != -1, "The node was already released to this pool.");
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "The node is queued for deletion and can't be released to the pool.");
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	if ((max_size > 0 && available.size() >= uint32_t(max_size)) || !_restore_state(p_node, *state)) {
+		// Instances usually release themselves from their own scripts or signal callbacks,
+		// so they can't be freed right away.
+		instance_states.erase(p_node->get_instance_id());
+		p_node->queue_free();
+		return;
+	}
+
+	state->recycled = true;
+	available.push_back(p_node);
+}
+
+void ScenePool::prefill(int p_count) {
+	if (max_size > 0) {
+		p_count = MIN(p_count, max_size);
+	}
+	while (available.size() < uint32_t(MAX(p_count, 0))) {
+		Node *node = _create_instance();
+		ERR_FAIL_NULL(node);
+		available.push_back(node);
+	}
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+void ScenePool::clear() {
+	for (Node *node : available) {
+		instance_states.erase(node->get_instance_id());
+		memdelete(node);
+	}
+	available.clear();
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("prefill", "count"), &ScenePool::prefill);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
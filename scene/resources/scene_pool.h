@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*  scene_pool.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_POOL_H
+#define SCENE_POOL_H
+
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+#include "scene/resources/packed_scene.h"
+
+class ScenePool : public RefCounted {
+	GDCLASS(ScenePool, RefCounted);
+
+	// State of a node right after instantiation, restored when its scene is released to the pool.
+	// It's the same for every instance, so it's only recorded once.
+	struct NodeState {
+		int parent = -1; // Position of the parent in the recorded nodes.
+		int index = 0;
+		StringName name;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	// Property value of an instance that differs from the recorded one, like a resource local to the scene.
+	struct PropertyOverride {
+		uint32_t node = 0;
+		uint32_t property = 0;
+		Variant value;
+	};
+
+	struct InstanceState {
+		LocalVector<ObjectID> nodes; // In the same order as the recorded nodes.
+		LocalVector<PropertyOverride> overrides; // Sorted by node and property.
+		bool recycled = false; // Released at least once, as opposed to only created by prefill().
+	};
+
+	Ref<PackedScene> scene;
+	int max_size = 0;
+
+	LocalVector<NodeState> scene_state;
+	LocalVector<Node *> available; // Released instances, ready to be acquired again.
+	HashMap<ObjectID, InstanceState> instance_states; // Instances created by this pool, by root.
+	uint32_t instance_states_prune_size = 64;
+
+	static void _collect_nodes(Node *p_node, LocalVector<Node *> &r_nodes);
+	void _record_scene_state(const LocalVector<Node *> &p_nodes);
+	bool _restore_state(Node *p_root, const InstanceState &p_state) const;
+	Node *_create_instance();
+	void _prune_instance_states();
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_scene(const Ref<PackedScene> &p_scene);
+	Ref<PackedScene> get_scene() const;
+
+	void set_max_size(int p_max_size);
+	int get_max_size() const;
+
+	Node *acquire();
+	void release(Node *p_node);
+	void prefill(int p_count);
+	int get_available_count() const;
+	void clear();
+
+	~ScenePool();
+};
+
+#endif // SCENE_POOL_H
@@ -2203,6 +2203,36 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	_skeleton_make_dirty(skeleton);
 }
 
+void MeshStorage::skeleton_set_bone_transforms(RID p_skeleton, const Vector<Transform3D> &p_transforms) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(p_transforms.size() > skeleton->size);
+	ERR_FAIL_COND(skeleton->use_2d);
+
+	const Transform3D *transforms = p_transforms.ptr();
+	float *dataptr = skeleton->data.ptrw();
+
+	for (int i = 0; i < p_transforms.size(); i++) {
+		const Transform3D &t = transforms[i];
+		dataptr[0] = t.basis.rows[0][0];
+		dataptr[1] = t.basis.rows[0][1];
+		dataptr[2] = t.basis.rows[0][2];
+		dataptr[3] = t.origin.x;
+		dataptr[4] = t.basis.rows[1][0];
+		dataptr[5] = t.basis.rows[1][1];
+		dataptr[6] = t.basis.rows[1][2];
+		dataptr[7] = t.origin.y;
+		dataptr[8] = t.basis.rows[2][0];
+		dataptr[9] = t.basis.rows[2][1];
+		dataptr[10] = t.basis.rows[2][2];
+		dataptr[11] = t.origin.z;
+		dataptr += 12;
+	}
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -940,6 +940,29 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		// Instances may have been freed since the batch was recorded.
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		if (!instance || instance->transform == transforms[i]) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		if (!transforms[i].basis.rows[0].is_finite() || !transforms[i].basis.rows[1].is_finite() || !transforms[i].basis.rows[2].is_finite() || !transforms[i].origin.is_finite()) {
+			ERR_PRINT("Non-finite instance transform, ignoring.");
+			continue;
+		}
+#endif
+		instance->transform = transforms[i];
+		_instance_queue_update(instance, true);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
@@ -211,6 +211,54 @@ TEST_CASE("[Image] Resizing") {
 			"get_size() should return the correct size after resize_to_po2().");
 }
 
+TEST_CASE("[Image] Resizing and generating mipmaps of large images") {
+	// Large enough for the work to be split in row chunks across threads.
+	const Color fill = Color(0.2, 0.4, 0.6, 0.8);
+	const Image::Format formats[] = { Image::FORMAT_RGBA8, Image::FORMAT_RGBAF, Image::FORMAT_RGBAH };
+
+	for (const Image::Format format : formats) {
+		for (int i = 0; i < 5; i++) {
+			Ref<Image> image = Image::create_empty(1024, 1024, false, format);
+			image->fill(fill);
+			Image::Interpolation interpolation = static_cast<Image::Interpolation>(i);
+			image->resize(700, 900, interpolation);
+			REQUIRE(image->get_size() == Vector2(700, 900));
+
+			bool matches = true;
+			for (int y = 0; y < 900; y += 37) {
+				for (int x = 0; x < 700; x += 53) {
+					Color c = image->get_pixel(x, y);
+					matches = matches && Math::abs(c.r - fill.r) < 0.01 && Math::abs(c.g - fill.g) < 0.01 && Math::abs(c.b - fill.b) < 0.01 && Math::abs(c.a - fill.a) < 0.01;
+				}
+			}
+			CHECK_MESSAGE(
+					matches,
+					vformat("Resizing a uniform image of format %d with interpolation %d should keep every row uniform.", format, i));
+		}
+
+		Ref<Image> image = Image::create_empty(1024, 512, false, format);
+		for (int y = 0; y < 512; y++) {
+			for (int x = 0; x < 1024; x++) {
+				image->set_pixel(x, y, (y % 2) ? Color(1, 1, 1, 1) : Color(0, 0, 0, 0));
+			}
+		}
+		image->generate_mipmaps();
+		REQUIRE(image->has_mipmaps());
+
+		Ref<Image> mip = image->get_image_from_mipmap(1);
+		REQUIRE(mip->get_size() == Vector2(512, 256));
+		bool matches = true;
+		for (int y = 0; y < 256; y += 7) {
+			for (int x = 0; x < 512; x += 11) {
+				matches = matches && Math::abs(mip->get_pixel(x, y).r - 0.5) < 0.01;
+			}
+		}
+		CHECK_MESSAGE(
+				matches,
+				vformat("Every row of the first mipmap of format %d should average two source rows.", format));
+	}
+}
+
 TEST_CASE("[Image] Modifying pixels of an image") {
 	Ref<Image> image = memnew(Image(3, 3, false, Image::FORMAT_RGBA8));
 	image->set_pixel(0, 0, Color(1, 1, 1, 1));
@@ -110,6 +110,44 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading many sub-resources") {
+	// Enough sub-resources for the binary saver to serialize them in parallel.
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	for (int i = 0; i < 100; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		child_resource->set_meta("index", i);
+		child_resource->set_meta("path", NodePath(vformat("Node%d/Child:position", i)));
+		if (i > 0) {
+			child_resource->set_meta("previous", children[i - 1]);
+		}
+		children.push_back(child_resource);
+	}
+	resource->set_meta("children", children);
+
+	const String save_path_binary = OS::get_singleton()->get_cache_path().path_join("resource.res");
+	ResourceSaver::save(resource, save_path_binary);
+
+	const Ref<Resource> &loaded_resource = ResourceLoader::load(save_path_binary, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK(loaded_resource->get_name() == "Root");
+	const Array loaded_children = loaded_resource->get_meta("children");
+	REQUIRE(loaded_children.size() == 100);
+	bool all_equal = true;
+	for (int i = 0; i < 100; i++) {
+		const Ref<Resource> child_resource = loaded_children[i];
+		all_equal = all_equal && child_resource->get_name() == vformat("Child %d", i);
+		all_equal = all_equal && int(child_resource->get_meta("index")) == i;
+		all_equal = all_equal && NodePath(child_resource->get_meta("path")) == NodePath(vformat("Node%d/Child:position", i));
+		if (i > 0) {
+			all_equal = all_equal && Ref<Resource>(child_resource->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]);
+		}
+	}
+	CHECK_MESSAGE(all_equal, "The loaded sub-resources should be equal to the saved ones, in the same order.");
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -169,6 +169,49 @@ TEST_CASE("[Array] sort()") {
 	}
 }
 
+TEST_CASE("[Array] Typed array sort(), find(), rfind() and count()") {
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Variant());
+	ints.push_back(3);
+	ints.push_back(-4);
+	ints.push_back(2);
+	ints.push_back(3);
+	ints.sort();
+	CHECK(int(ints[0]) == -4);
+	CHECK(int(ints[1]) == 2);
+	CHECK(int(ints[2]) == 3);
+	CHECK(int(ints[3]) == 3);
+	CHECK(ints.find(3) == 2);
+	CHECK(ints.rfind(3) == 3);
+	CHECK(ints.count(3) == 2);
+	CHECK(ints.find(5) == -1);
+
+	Array floats;
+	floats.set_typed(Variant::FLOAT, StringName(), Variant());
+	floats.push_back(1.5);
+	floats.push_back(2); // Converted to float.
+	floats.push_back(-0.5);
+	floats.push_back(NAN);
+	CHECK(floats[1].get_type() == Variant::FLOAT);
+	CHECK(floats.find(2.0) == 1);
+	CHECK(floats.find(NAN) == 3);
+	CHECK(floats.count(1.5) == 1);
+	floats.remove_at(3);
+	floats.sort();
+	CHECK(double(floats[0]) == -0.5);
+	CHECK(double(floats[1]) == 1.5);
+	CHECK(double(floats[2]) == 2.0);
+
+	// Elements of other types are never equal to numbers.
+	Array mixed;
+	mixed.push_back(1.0);
+	mixed.push_back("1");
+	mixed.push_back(1);
+	CHECK(mixed.find(1) == 2);
+	CHECK(mixed.find(1.0) == 0);
+	CHECK(mixed.count(1) == 1);
+}
+
 TEST_CASE("[Array] push_front(), pop_front(), pop_back()") {
 	Array arr;
 	arr.push_front(1);
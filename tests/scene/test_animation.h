@@ -31,8 +31,17 @@
 #ifndef TEST_ANIMATION_H
 #define TEST_ANIMATION_H
 
+#include "core/config/project_settings.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
 #include "scene/resources/animation.h"
 
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#endif // _3D_DISABLED
+
 #include "tests/test_macros.h"
 
 namespace TestAnimation {
@@ -309,6 +318,239 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sample tracks with a cursor") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(4.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	for (int i = 0; i <= 40; i++) {
+		animation->position_track_insert_key(position_track, i * 0.1, Vector3(i, Math::sin(i * 0.3), 0));
+		animation->rotation_track_insert_key(rotation_track, i * 0.1, Quaternion(Vector3(0, 1, 0), i * 0.2));
+	}
+
+	// Forward playback, jumps back to the start, and times exactly on keys.
+	LocalVector<double> times;
+	for (int i = 0; i <= 200; i++) {
+		times.push_back(i * 0.02);
+	}
+	times.push_back(0.5);
+	times.push_back(3.9);
+	times.push_back(0.0);
+	times.push_back(-1.0);
+	times.push_back(5.0);
+	times.push_back(1.7);
+
+	for (int pass = 0; pass < 2; pass++) {
+		if (pass == 1) {
+			animation->compress();
+			REQUIRE(animation->track_is_compressed(position_track));
+		}
+
+		Animation::TrackCursor position_cursor;
+		Animation::TrackCursor rotation_cursor;
+		for (double time : times) {
+			Vector3 position;
+			Vector3 position_with_cursor;
+			CHECK(animation->try_position_track_interpolate(position_track, time, &position) == OK);
+			CHECK(animation->try_position_track_interpolate(position_track, time, &position_with_cursor, false, &position_cursor) == OK);
+			CHECK(position_with_cursor == position);
+
+			Quaternion rotation;
+			Quaternion rotation_with_cursor;
+			CHECK(animation->try_rotation_track_interpolate(rotation_track, time, &rotation) == OK);
+			CHECK(animation->try_rotation_track_interpolate(rotation_track, time, &rotation_with_cursor, false, &rotation_cursor) == OK);
+			CHECK(rotation_with_cursor == rotation);
+		}
+	}
+}
+
+#ifndef _3D_DISABLED
+static Ref<Animation> _create_constant_transform_animation(int p_node_count, const Vector3 &p_position, const Quaternion &p_rotation) {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(1.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+	for (int i = 0; i < p_node_count; i++) {
+		const NodePath path = NodePath(vformat("Node%d", i));
+		int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(track_index, path);
+		animation->position_track_insert_key(track_index, 0.0, p_position);
+		animation->position_track_insert_key(track_index, 1.0, p_position);
+		track_index = animation->add_track(Animation::TYPE_ROTATION_3D);
+		animation->track_set_path(track_index, path);
+		animation->rotation_track_insert_key(track_index, 0.0, p_rotation);
+		animation->rotation_track_insert_key(track_index, 1.0, p_rotation);
+	}
+	return animation;
+}
+
+static AnimationPlayer *_create_transform_player(Node3D *p_root, int p_node_count) {
+	for (int i = 0; i < p_node_count; i++) {
+		Node3D *node = memnew(Node3D);
+		node->set_name(vformat("Node%d", i));
+		p_root->add_child(node);
+	}
+
+	Ref<AnimationLibrary> library = memnew(AnimationLibrary);
+	library->add_animation("idle", _create_constant_transform_animation(p_node_count, Vector3(), Quaternion()));
+	library->add_animation("walk", _create_constant_transform_animation(p_node_count, Vector3(2, 0, 0), Quaternion(Vector3(0, 1, 0), Math_PI / 2)));
+
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_MANUAL);
+	player->add_animation_library("", library);
+	p_root->add_child(player);
+	return player;
+}
+
+TEST_CASE("[SceneTree][Animation] Blend transform tracks with AnimationPlayer") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	AnimationPlayer *player = _create_transform_player(root, 4);
+
+	player->play("walk");
+	player->advance(0.25);
+	for (int i = 0; i < 4; i++) {
+		Node3D *node = Object::cast_to<Node3D>(root->get_child(i));
+		CHECK(node->get_position().is_equal_approx(Vector3(2, 0, 0)));
+		CHECK(node->get_quaternion().is_equal_approx(Quaternion(Vector3(0, 1, 0), Math_PI / 2)));
+	}
+
+	SUBCASE("Cross-fading weights both animations") {
+		player->play("idle", 1.0);
+		player->advance(0.5);
+		for (int i = 0; i < 4; i++) {
+			Node3D *node = Object::cast_to<Node3D>(root->get_child(i));
+			CHECK(node->get_position().x > 0);
+			CHECK(node->get_position().x < 2);
+			CHECK(node->get_position().y == doctest::Approx(0.0));
+		}
+
+		player->advance(1.0);
+		for (int i = 0; i < 4; i++) {
+			Node3D *node = Object::cast_to<Node3D>(root->get_child(i));
+			CHECK(node->get_position().is_equal_approx(Vector3()));
+			CHECK(node->get_quaternion().is_equal_approx(Quaternion()));
+		}
+	}
+
+	memdelete(root);
+}
+
+static void _check_mixers_blend(bool p_parallel_blending, bool p_sub_thread) {
+	ProjectSettings::get_singleton()->set_setting("animation/mixers/parallel_blending", p_parallel_blending);
+
+	Node3D *root = memnew(Node3D);
+	if (p_sub_thread) {
+		root->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	// Enough players for the parallel path to blend on the WorkerThreadPool.
+	const int player_count = 4;
+	LocalVector<Node3D *> characters;
+	for (int i = 0; i < player_count; i++) {
+		Node3D *character = memnew(Node3D);
+		root->add_child(character);
+		AnimationPlayer *player = _create_transform_player(character, 2);
+
+		// Bone positions are scaled by the motion scale of the skeleton.
+		Skeleton3D *skeleton = memnew(Skeleton3D);
+		skeleton->set_name("Skeleton");
+		skeleton->add_bone("bone");
+		skeleton->set_motion_scale(2.0);
+		character->add_child(skeleton);
+		Ref<Animation> walk = player->get_animation("walk");
+		const int track_index = walk->add_track(Animation::TYPE_POSITION_3D);
+		walk->track_set_path(track_index, NodePath("Skeleton:bone"));
+		walk->position_track_insert_key(track_index, 0.0, Vector3(1, 0, 0));
+		walk->position_track_insert_key(track_index, 1.0, Vector3(1, 0, 0));
+
+		player->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_IDLE);
+		player->play("walk");
+		characters.push_back(character);
+	}
+
+	// The first frame builds the caches, the next ones may blend off the main thread.
+	for (int frame = 0; frame < 3; frame++) {
+		for (Node3D *character : characters) {
+			Object::cast_to<Node3D>(character->get_node(NodePath("Node0")))->set_position(Vector3());
+		}
+		SceneTree::get_singleton()->process(1.0 / 60.0);
+		for (Node3D *character : characters) {
+			CHECK(Object::cast_to<Node3D>(character->get_node(NodePath("Node0")))->get_position().is_equal_approx(Vector3(2, 0, 0)));
+			CHECK(Object::cast_to<Node3D>(character->get_node(NodePath("Node1")))->get_quaternion().is_equal_approx(Quaternion(Vector3(0, 1, 0), Math_PI / 2)));
+			CHECK(Object::cast_to<Skeleton3D>(character->get_node(NodePath("Skeleton")))->get_bone_pose_position(0).is_equal_approx(Vector3(2, 0, 0)));
+		}
+	}
+
+	memdelete(root);
+	ProjectSettings::get_singleton()->set_setting("animation/mixers/parallel_blending", false);
+}
+
+TEST_CASE("[SceneTree][Animation] Blend AnimationMixers with and without parallel blending") {
+	SUBCASE("Main thread") {
+		_check_mixers_blend(false, false);
+	}
+	SUBCASE("Main thread with parallel blending") {
+		_check_mixers_blend(true, false);
+	}
+	SUBCASE("Sub-thread group") {
+		_check_mixers_blend(false, true);
+	}
+	SUBCASE("Sub-thread group with parallel blending") {
+		_check_mixers_blend(true, true);
+	}
+}
+
+TEST_CASE("[SceneTree][Animation] Reduce update rate of off-screen AnimationMixer") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	Node3D *node = memnew(Node3D);
+	node->set_name("Node0");
+	root->add_child(node);
+	// Never rendered in tests, so always off-screen.
+	VisibleOnScreenNotifier3D *notifier = memnew(VisibleOnScreenNotifier3D);
+	notifier->set_name("Notifier");
+	root->add_child(notifier);
+
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(10.0);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Node0"));
+	animation->position_track_insert_key(track_index, 0.0, Vector3());
+	animation->position_track_insert_key(track_index, 10.0, Vector3(10, 0, 0));
+	Ref<AnimationLibrary> library = memnew(AnimationLibrary);
+	library->add_animation("move", animation);
+
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_IDLE);
+	player->add_animation_library("", library);
+	root->add_child(player);
+	player->set_lod_visibility_notifier(NodePath("../Notifier"));
+	player->set_lod_update_interval(0.5);
+	player->set_lod_interpolate(false);
+
+	player->play("move");
+	for (int i = 0; i < 4; i++) {
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(player->is_lod_reduced());
+		CHECK(node->get_position().is_equal_approx(Vector3()));
+	}
+
+	// The elapsed time is applied at once.
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(node->get_position().x > 0.0);
+	const real_t reduced_x = node->get_position().x;
+
+	player->set_lod_update_interval(0.0);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK_FALSE(player->is_lod_reduced());
+	CHECK(node->get_position().x > reduced_x);
+
+	memdelete(root);
+}
+
+#endif // _3D_DISABLED
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
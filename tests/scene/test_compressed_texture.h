@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  test_compressed_texture.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_COMPRESSED_TEXTURE_H
+#define TEST_COMPRESSED_TEXTURE_H
+
+#ifdef TOOLS_ENABLED
+
+#include "core/config/project_settings.h"
+#include "core/io/image.h"
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+#include "editor/import/resource_importer_texture.h"
+#include "scene/resources/compressed_texture.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCompressedTexture {
+
+// Writes the image as the texture importer does with uncompressed VRAM data.
+static void _save_streamable_ctex(const Ref<Image> &p_image, const String &p_path) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_8('G');
+	f->store_8('S');
+	f->store_8('T');
+	f->store_8('2');
+	f->store_32(CompressedTexture2D::FORMAT_VERSION);
+	f->store_32(p_image->get_width());
+	f->store_32(p_image->get_height());
+	f->store_32(CompressedTexture2D::FORMAT_BIT_STREAM | CompressedTexture2D::FORMAT_BIT_HAS_MIPMAPS);
+	f->store_32(-1);
+	f->store_32(0);
+	f->store_32(0);
+	f->store_32(0);
+	ResourceImporterTexture::save_to_ctex_format(f, p_image, ResourceImporterTexture::COMPRESS_VRAM_UNCOMPRESSED, Image::USED_CHANNELS_RGBA, Image::COMPRESS_S3TC, 0.7);
+}
+
+// Streamed mipmaps are loaded in a worker thread and applied with a deferred call.
+static void _wait_for_streaming(const Ref<CompressedTexture2D> &p_texture, bool p_fully_resident) {
+	for (int i = 0; i < 5000 && p_texture->is_fully_resident() != p_fully_resident; i++) {
+		MessageQueue::get_singleton()->flush();
+		OS::get_singleton()->delay_usec(1000);
+	}
+}
+
+TEST_CASE("[SceneTree][CompressedTexture2D] Stream the mipmaps of a saved texture") {
+	Ref<Image> image = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8);
+	image->fill(Color(1, 0, 0));
+	image->generate_mipmaps();
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("streamed.ctex");
+	_save_streamable_ctex(image, save_path);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size_limit", 16);
+
+	Ref<CompressedTexture2D> texture;
+	texture.instantiate();
+	REQUIRE(texture->load(save_path) == OK);
+	CHECK(texture->get_width() == 64);
+	CHECK(texture->get_height() == 64);
+	CHECK_FALSE(texture->is_fully_resident());
+	// The mipmaps larger than the initial size limit are skipped.
+	Ref<Image> initial_image = texture->get_image();
+	REQUIRE(initial_image.is_valid());
+	CHECK(initial_image->get_width() == 16);
+	CHECK(initial_image->get_height() == 16);
+	CHECK(initial_image->get_pixel(0, 0).is_equal_approx(Color(1, 0, 0)));
+
+	texture->request_mip_size(64);
+	// Loaded in the background.
+	CHECK_FALSE(texture->is_fully_resident());
+	_wait_for_streaming(texture, true);
+	CHECK(texture->is_fully_resident());
+
+	texture->evict_streamed_mips();
+	_wait_for_streaming(texture, false);
+	CHECK_FALSE(texture->is_fully_resident());
+
+	// Superseded loads are discarded, only the last request is applied.
+	texture->request_mip_size(32);
+	texture->request_mip_size(64);
+	texture->evict_streamed_mips();
+	texture->request_mip_size(64);
+	_wait_for_streaming(texture, true);
+	CHECK(texture->is_fully_resident());
+
+	// Drawing in 2D requests the mipmaps needed for the size the texture is drawn at.
+	texture->evict_streamed_mips();
+	_wait_for_streaming(texture, false);
+	RID canvas_item = RS::get_singleton()->canvas_item_create();
+	texture->draw_rect(canvas_item, Rect2(0, 0, 16, 16));
+	texture->draw_rect_region(canvas_item, Rect2(0, 0, 32, 32), Rect2(0, 0, 64, 64));
+	CHECK(texture->get_image()->get_width() == 16);
+	texture->draw_rect_region(canvas_item, Rect2(0, 0, 32, 32), Rect2(0, 0, 32, 32));
+	_wait_for_streaming(texture, true);
+	CHECK(texture->is_fully_resident());
+	RS::get_singleton()->free(canvas_item);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", false);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size_limit", 256);
+}
+
+} // namespace TestCompressedTexture
+
+#endif // TOOLS_ENABLED
+
+#endif // TEST_COMPRESSED_TEXTURE_H
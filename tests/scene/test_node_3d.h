@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*  test_node_2d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/primitive_meshes.h"
+#include "scene/resources/3d/world_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformChangeCounter : public Node3D {
+	GDCLASS(TransformChangeCounter, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			changes++;
+		}
+	}
+
+public:
+	int changes = 0;
+
+	TransformChangeCounter() {
+		set_notify_transform(true);
+	}
+};
+
+// Moves another node when notified of its own transform change.
+class TransformChangeMover : public Node3D {
+	GDCLASS(TransformChangeMover, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what != NOTIFICATION_TRANSFORM_CHANGED || !target) {
+			return;
+		}
+		Node3D *moved = target;
+		target = nullptr;
+		moved->set_position(Vector3(50, 0, 0));
+		if (nested_flush) {
+			get_tree()->flush_transform_notifications();
+		}
+		moved->set_position(Vector3(100, 0, 0));
+		moved->force_update_transform();
+	}
+
+public:
+	Node3D *target = nullptr;
+	bool nested_flush = false;
+
+	TransformChangeMover() {
+		set_notify_transform(true);
+	}
+};
+
+static bool _is_rendered_at(VisualInstance3D *p_instance, const Vector3 &p_position) {
+	const AABB aabb(p_position - Vector3(0.5, 0.5, 0.5), Vector3(1, 1, 1));
+	Vector<ObjectID> instances = RS::get_singleton()->instances_cull_aabb(aabb, p_instance->get_world_3d()->get_scenario());
+	return instances.has(p_instance->get_instance_id());
+}
+
+TEST_CASE("[SceneTree][Node3D] Global transform propagation") {
+	Node3D *root = memnew(Node3D);
+	Node3D *middle = memnew(Node3D);
+	Node3D *leaf = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	root->add_child(middle);
+	middle->add_child(leaf);
+	middle->set_position(Vector3(0, 10, 0));
+	leaf->set_position(Vector3(0, 0, 1));
+
+	SUBCASE("Moving an ancestor several times without reading the global transform in between") {
+		root->set_position(Vector3(1, 0, 0));
+		root->set_position(Vector3(2, 0, 0));
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 10, 1)));
+
+		root->set_position(Vector3(4, 0, 0));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(4, 10, 0)));
+		root->set_position(Vector3(5, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(5, 10, 1)));
+	}
+
+	SUBCASE("Nodes notified of transform changes below dirty nodes") {
+		TransformChangeCounter *counter = memnew(TransformChangeCounter);
+		leaf->add_child(counter);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		counter->changes = 0;
+
+		// `middle` and `leaf` stay dirty, as nothing reads their global transform.
+		root->set_position(Vector3(1, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(counter->changes == 1);
+		root->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(counter->changes == 2);
+
+		counter->set_notify_transform(false);
+		root->set_position(Vector3(3, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(counter->changes == 2);
+		CHECK(counter->get_global_position().is_equal_approx(Vector3(3, 10, 1)));
+
+		// Subscribing again, and moving the subscriber to another subtree.
+		counter->set_notify_transform(true);
+		leaf->remove_child(counter);
+		root->add_child(counter);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		counter->changes = 0;
+		root->set_position(Vector3(4, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(counter->changes == 1);
+		CHECK(counter->get_global_position().is_equal_approx(Vector3(4, 0, 0)));
+
+		memdelete(counter);
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][VisualInstance3D] Transforms changed while flushing transform notifications") {
+	Ref<BoxMesh> box;
+	box.instantiate();
+	MeshInstance3D *mesh_instance = memnew(MeshInstance3D);
+	mesh_instance->set_mesh(box);
+	mesh_instance->set_custom_aabb(AABB(Vector3(-0.1, -0.1, -0.1), Vector3(0.2, 0.2, 0.2)));
+	TransformChangeMover *mover = memnew(TransformChangeMover);
+	SceneTree::get_singleton()->get_root()->add_child(mesh_instance);
+	SceneTree::get_singleton()->get_root()->add_child(mover);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	SUBCASE("Forced update from a notification") {
+		mover->nested_flush = false;
+	}
+	SUBCASE("Nested flush from a notification") {
+		mover->nested_flush = true;
+	}
+
+	// The mesh instance is notified first, then moved again by the mover.
+	mover->target = mesh_instance;
+	mesh_instance->set_position(Vector3(10, 0, 0));
+	mover->set_position(Vector3(1, 0, 0));
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	CHECK(mesh_instance->get_global_position().is_equal_approx(Vector3(100, 0, 0)));
+	CHECK_MESSAGE(_is_rendered_at(mesh_instance, Vector3(100, 0, 0)), "The last transform set during the flush should be the one sent to the RenderingServer.");
+	CHECK_FALSE(_is_rendered_at(mesh_instance, Vector3(10, 0, 0)));
+	CHECK_FALSE(_is_rendered_at(mesh_instance, Vector3(50, 0, 0)));
+
+	memdelete(mover);
+	memdelete(mesh_instance);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
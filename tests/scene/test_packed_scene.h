@@ -31,6 +31,7 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +151,95 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene With Properties") {
+	// Create a scene to pack.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(10, 20));
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_rotation(0.5);
+	child->set_z_index(3);
+	child->set_visible(false);
+	child->set_modulate(Color(1, 0, 0));
+	child->set_meta("custom", 42);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	// Instantiate the packed scene, with and without edit state.
+	for (int i = 0; i < 2; i++) {
+		Node *instance = packed_scene->instantiate(i == 0 ? PackedScene::GEN_EDIT_STATE_DISABLED : PackedScene::GEN_EDIT_STATE_INSTANCE);
+		Node2D *instance_2d = Object::cast_to<Node2D>(instance);
+		REQUIRE(instance_2d != nullptr);
+		CHECK(instance_2d->get_position() == Vector2(10, 20));
+
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_rotation() == doctest::Approx(0.5));
+		CHECK(instance_child->get_z_index() == 3);
+		CHECK_FALSE(instance_child->is_visible());
+		CHECK(instance_child->get_modulate() == Color(1, 0, 0));
+		CHECK(int(instance_child->get_meta("custom")) == 42);
+
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse the previous instantiation.
+	child->set_z_index(7);
+	packed_scene->pack(scene);
+	Node *instance = packed_scene->instantiate();
+	CHECK(Object::cast_to<Node2D>(instance->get_node(NodePath("Child")))->get_z_index() == 7);
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
+TEST_CASE("[PackedScene] Instantiate Scene State Edited After Instantiation") {
+	// Build the state by hand, as the text scene loader does.
+	Ref<SceneState> state;
+	state.instantiate();
+	int root = state->add_node(-1, -1, state->add_name("Node2D"), state->add_name("Root"), -1, -1);
+	state->add_node_property(root, state->add_name("z_index"), state->add_value(3));
+	int group_name = state->add_name("group");
+	state->add_node_group(root, group_name);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->replace_state(state);
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_z_index() == 3);
+	CHECK(instance->is_in_group("group"));
+	memdelete(instance);
+
+	// Every edit must be picked up by the next instantiation.
+	state->add_node_property(root, state->add_name("visible"), state->add_value(false));
+	state->rename_group_references("group", "renamed");
+
+	instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_z_index() == 3);
+	CHECK_FALSE(instance->is_visible());
+	CHECK(instance->is_in_group("renamed"));
+	CHECK_FALSE(instance->is_in_group("group"));
+	memdelete(instance);
+
+	// A value the setter does not accept is left to Object::set(), as without the resolved setters.
+	state->add_node_property(root, state->add_name("z_index"), state->add_value("invalid"));
+
+	instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_z_index() == 3);
+	memdelete(instance);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
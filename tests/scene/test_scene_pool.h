@@ -0,0 +1,222 @@
+/**************************************************************************/
+/*  test_scene_pool.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_POOL_H
+#define TEST_SCENE_POOL_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/scene_pool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+class RecycleCounter : public Node {
+	GDCLASS(RecycleCounter, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_SCENE_RECYCLED) {
+			recycled++;
+		}
+	}
+
+public:
+	int recycled = 0;
+};
+
+class SelfReleaser : public Node {
+	GDCLASS(SelfReleaser, Node);
+
+protected:
+	static void _bind_methods() {
+		ADD_SIGNAL(MethodInfo("hit"));
+	}
+
+public:
+	Ref<ScenePool> pool;
+	bool released = false;
+
+	void _on_hit() {
+		pool->release(this);
+		released = true;
+	}
+};
+
+static Ref<PackedScene> _create_packed_scene() {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("Bullet");
+	scene->set_position(Vector2(1, 2));
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Sprite");
+	child->set_z_index(4);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+	return packed_scene;
+}
+
+TEST_CASE("[ScenePool] Acquire and release") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+	CHECK(pool->get_available_count() == 0);
+
+	Node2D *instance = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(instance != nullptr);
+	Node2D *child = Object::cast_to<Node2D>(instance->get_node(NodePath("Sprite")));
+	REQUIRE(child != nullptr);
+
+	// Modify the instance the way gameplay code would.
+	Node *parent = memnew(Node);
+	parent->add_child(instance);
+	instance->set_position(Vector2(100, 200));
+	child->set_z_index(9);
+	child->set_name("Renamed");
+	Node *extra = memnew(Node);
+	instance->add_child(extra);
+	ObjectID extra_id = extra->get_instance_id();
+
+	pool->release(instance);
+	CHECK(pool->get_available_count() == 1);
+	CHECK(instance->get_parent() == nullptr);
+	CHECK(extra->get_parent() == nullptr);
+	SceneTree::get_singleton()->process(0);
+	CHECK(ObjectDB::get_instance(extra_id) == nullptr);
+
+	Node2D *reused = Object::cast_to<Node2D>(pool->acquire());
+	CHECK_MESSAGE(reused == instance, "The released instance should be reused.");
+	CHECK(pool->get_available_count() == 0);
+	CHECK(reused->get_position() == Vector2(1, 2));
+	CHECK(reused->get_child_count() == 1);
+	Node2D *reused_child = Object::cast_to<Node2D>(reused->get_node_or_null(NodePath("Sprite")));
+	REQUIRE(reused_child != nullptr);
+	CHECK(reused_child == child);
+	CHECK(reused_child->get_z_index() == 4);
+
+	memdelete(reused);
+	memdelete(parent);
+}
+
+TEST_CASE("[ScenePool] Instances that can't be restored are freed") {
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(_create_packed_scene());
+
+	Node *instance = pool->acquire();
+	ObjectID instance_id = instance->get_instance_id();
+	memdelete(instance->get_node(NodePath("Sprite")));
+	pool->release(instance);
+	CHECK(pool->get_available_count() == 0);
+	SceneTree::get_singleton()->process(0);
+	CHECK(ObjectDB::get_instance(instance_id) == nullptr);
+
+	pool->set_max_size(1);
+	Node *first = pool->acquire();
+	Node *second = pool->acquire();
+	ObjectID second_id = second->get_instance_id();
+	pool->release(first);
+	pool->release(second);
+	CHECK(pool->get_available_count() == 1);
+	SceneTree::get_singleton()->process(0);
+	CHECK(ObjectDB::get_instance(second_id) == nullptr);
+}
+
+TEST_CASE("[ScenePool] Instances releasing themselves when the pool is full") {
+	GDREGISTER_CLASS(SelfReleaser);
+
+	SelfReleaser *scene = memnew(SelfReleaser);
+	scene->set_name("Projectile");
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+	pool->set_max_size(1);
+
+	SelfReleaser *first = Object::cast_to<SelfReleaser>(pool->acquire());
+	SelfReleaser *second = Object::cast_to<SelfReleaser>(pool->acquire());
+	REQUIRE(first != nullptr);
+	REQUIRE(second != nullptr);
+	ObjectID second_id = second->get_instance_id();
+	pool->release(first);
+	CHECK(pool->get_available_count() == 1);
+
+	// Released from a signal callback of the instance while the pool has no room for it.
+	second->pool = pool;
+	second->connect(SNAME("hit"), callable_mp(second, &SelfReleaser::_on_hit));
+	second->emit_signal(SNAME("hit"));
+	CHECK_MESSAGE(second->released, "The instance should still be valid after releasing itself.");
+	CHECK(second->is_queued_for_deletion());
+	CHECK(pool->get_available_count() == 1);
+
+	SceneTree::get_singleton()->process(0);
+	CHECK(ObjectDB::get_instance(second_id) == nullptr);
+}
+
+TEST_CASE("[ScenePool] Recycled notification") {
+	GDREGISTER_CLASS(RecycleCounter);
+
+	RecycleCounter *scene = memnew(RecycleCounter);
+	scene->set_name("Effect");
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+	pool->prefill(2);
+	CHECK(pool->get_available_count() == 2);
+
+	RecycleCounter *instance = Object::cast_to<RecycleCounter>(pool->acquire());
+	REQUIRE(instance != nullptr);
+	CHECK_MESSAGE(instance->recycled == 0, "Prefilled instances are new, not recycled.");
+	pool->release(instance);
+	CHECK(pool->acquire() == instance);
+	CHECK(instance->recycled == 1);
+
+	memdelete(instance);
+}
+
+} // namespace TestScenePool
+
+#endif // TEST_SCENE_POOL_H
@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  test_skeleton_3d.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SKELETON_3D_H
+#define TEST_SKELETON_3D_H
+
+#include "scene/3d/skeleton_3d.h"
+#include "scene/resources/3d/skin.h"
+
+#include "tests/test_macros.h"
+
+class TestSkeleton3DInternalsAccessor {
+public:
+	static void update_skins(Skeleton3D *p_skeleton) {
+		p_skeleton->_update_skins();
+	}
+	static void process_skin_updates() {
+		Skeleton3D::_process_skin_updates();
+	}
+	static Vector<Transform3D> &skin_transforms(const Ref<SkinReference> &p_skin_ref) {
+		return p_skin_ref->skin_transforms;
+	}
+};
+
+namespace TestSkeleton3D {
+
+class PoseUpdatedCounter : public Object {
+	GDCLASS(PoseUpdatedCounter, Object);
+
+public:
+	int count = 0;
+
+	void _on_pose_updated() {
+		count++;
+	}
+};
+
+TEST_CASE("[Skeleton3D] Skins computed in parallel match the serial update") {
+	const int skeleton_count = 3;
+	LocalVector<Skeleton3D *> skeletons;
+	LocalVector<Ref<SkinReference>> skin_refs;
+
+	for (int i = 0; i < skeleton_count; i++) {
+		Skeleton3D *skeleton = memnew(Skeleton3D);
+		for (int j = 0; j < 4; j++) {
+			skeleton->add_bone(vformat("Bone%d", j));
+			if (j > 0) {
+				skeleton->set_bone_parent(j, j - 1);
+			}
+			skeleton->set_bone_pose_position(j, Vector3(i + 1, j * 0.5, -j));
+			skeleton->set_bone_pose_rotation(j, Quaternion(Vector3(0, 1, 0), 0.3 * (i + j)));
+		}
+
+		// Bind one skin by index and another by name.
+		Ref<Skin> skin;
+		skin.instantiate();
+		Ref<Skin> named_skin;
+		named_skin.instantiate();
+		for (int j = 0; j < 4; j++) {
+			skin->add_bind(3 - j, Transform3D(Basis(Vector3(1, 0, 0), 0.2 * j), Vector3(0, -j, 0)));
+			named_skin->add_named_bind(vformat("Bone%d", j), Transform3D(Basis(), Vector3(j, 0, 1)));
+		}
+		skin_refs.push_back(skeleton->register_skin(skin));
+		skin_refs.push_back(skeleton->register_skin(named_skin));
+		skeletons.push_back(skeleton);
+	}
+
+	// Apply the poses set above first, so that the skeletons aren't dirty anymore.
+	for (Skeleton3D *skeleton : skeletons) {
+		skeleton->force_update_all_dirty_bones();
+	}
+	TestSkeleton3DInternalsAccessor::process_skin_updates();
+
+	// Serial update, as done for skeletons updated on a sub-thread.
+	for (Skeleton3D *skeleton : skeletons) {
+		TestSkeleton3DInternalsAccessor::update_skins(skeleton);
+	}
+	LocalVector<Vector<Transform3D>> serial_transforms;
+	for (uint32_t i = 0; i < skin_refs.size(); i++) {
+		Skeleton3D *skeleton = skeletons[i / 2];
+		Ref<Skin> skin = skin_refs[i]->get_skin();
+		Vector<Transform3D> &transforms = TestSkeleton3DInternalsAccessor::skin_transforms(skin_refs[i]);
+		REQUIRE(transforms.size() == skin->get_bind_count());
+		for (int j = 0; j < skin->get_bind_count(); j++) {
+			int bone = skin->get_bind_name(j) != StringName() ? skeleton->find_bone(skin->get_bind_name(j)) : skin->get_bind_bone(j);
+			CHECK(transforms[j].is_equal_approx(skeleton->get_bone_global_pose(bone) * skin->get_bind_pose(j)));
+		}
+		serial_transforms.push_back(transforms);
+		transforms.fill(Transform3D());
+	}
+
+	// Update queued from the main thread and computed on the worker thread pool.
+	PoseUpdatedCounter *counter = memnew(PoseUpdatedCounter);
+	for (Skeleton3D *skeleton : skeletons) {
+		skeleton->connect(SNAME("pose_updated"), callable_mp(counter, &PoseUpdatedCounter::_on_pose_updated));
+		skeleton->notification(Skeleton3D::NOTIFICATION_UPDATE_SKELETON);
+	}
+	CHECK_MESSAGE(counter->count == 0, "pose_updated should only be emitted once the skins are uploaded.");
+	TestSkeleton3DInternalsAccessor::process_skin_updates();
+	CHECK(counter->count == skeleton_count);
+
+	for (uint32_t i = 0; i < skin_refs.size(); i++) {
+		CHECK(TestSkeleton3DInternalsAccessor::skin_transforms(skin_refs[i]) == serial_transforms[i]);
+	}
+
+	skin_refs.clear();
+	for (Skeleton3D *skeleton : skeletons) {
+		memdelete(skeleton);
+	}
+	memdelete(counter);
+}
+
+} // namespace TestSkeleton3D
+
+#endif // TEST_SKELETON_3D_H
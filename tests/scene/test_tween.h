@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  test_tween.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TWEEN_H
+#define TEST_TWEEN_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/animation/tween.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTween {
+
+TEST_CASE("[SceneTree][Tween] Interpolate properties") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	Ref<Tween> tween = node->create_tween();
+	tween->set_parallel(true);
+	tween->set_trans(Tween::TRANS_SINE);
+	tween->tween_property(node, NodePath("position"), Vector2(10, 20), 1.0);
+	tween->tween_property(node, NodePath("rotation"), 2.0, 1.0);
+	tween->tween_property(node, NodePath("modulate"), Color(0, 0.5, 1, 0), 1.0);
+	tween->tween_property(node, NodePath("z_index"), 10, 1.0);
+
+	SceneTree::get_singleton()->process(0.25);
+
+	// Values must match the generic Variant interpolation.
+	Variant position = Tween::interpolate_variant(Vector2(), Vector2(10, 20), 0.25, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT);
+	Variant rotation = Tween::interpolate_variant(0.0, 2.0, 0.25, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT);
+	Variant modulate = Tween::interpolate_variant(Color(1, 1, 1, 1), Color(-1, -0.5, 0, -1), 0.25, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT);
+	Variant z_index = Tween::interpolate_variant(0, 10, 0.25, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT);
+	CHECK(node->get_position() == Vector2(position));
+	CHECK(node->get_rotation() == real_t(rotation));
+	CHECK(node->get_modulate() == Color(modulate));
+	CHECK(node->get_z_index() == int(z_index));
+
+	SceneTree::get_singleton()->process(1.0);
+
+	CHECK(node->get_position() == Vector2(10, 20));
+	CHECK(node->get_rotation() == 2.0);
+	CHECK(node->get_modulate() == Color(0, 0.5, 1, 0));
+	CHECK(node->get_z_index() == 10);
+
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Tween] Release finished tweens") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	Ref<Tween> short_tween = node->create_tween();
+	short_tween->tween_property(node, NodePath("position:x"), 1.0, 0.5);
+	Ref<Tween> long_tween = node->create_tween();
+	long_tween->tween_property(node, NodePath("position:y"), 1.0, 2.0);
+	Ref<Tween> last_tween = node->create_tween();
+	last_tween->tween_interval(2.0);
+
+	SceneTree::get_singleton()->process(1.0);
+
+	CHECK_FALSE(short_tween->is_valid());
+	CHECK(short_tween->get_reference_count() == 1);
+	CHECK(node->get_position().x == 1.0);
+
+	TypedArray<Tween> processed = SceneTree::get_singleton()->get_processed_tweens();
+	REQUIRE(processed.size() == 2);
+	CHECK(processed[0] == Variant(long_tween));
+	CHECK(processed[1] == Variant(last_tween));
+
+	SceneTree::get_singleton()->process(1.5);
+
+	CHECK(node->get_position().y == 1.0);
+	CHECK(SceneTree::get_singleton()->get_processed_tweens().is_empty());
+
+	memdelete(node);
+}
+
+} // namespace TestTween
+
+#endif // TEST_TWEEN_H